@@ -0,0 +1,182 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef _ARENA_ALLOCATOR_HPP_
+#define _ARENA_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace datasketches {
+
+/**
+ * Monotonic memory region for short-lived sketches.
+ * Memory is handed out by bumping a pointer through a list of chunks.
+ * Individual deallocation does nothing. All memory is reclaimed at once by reset(),
+ * which keeps the chunks for reuse, or by the destructor, which releases them.
+ * Destructors of objects in the arena still run as usual, so sketches must be destroyed
+ * (or go out of scope) before reset().
+ * Not thread safe.
+ */
+class monotonic_arena {
+public:
+  /**
+   * Constructor
+   * @param chunk_bytes size of each chunk requested from the system.
+   * Larger requests get a chunk of their own.
+   */
+  explicit monotonic_arena(size_t chunk_bytes = 1 << 16):
+  chunk_bytes_(chunk_bytes),
+  current_(0),
+  offset_(0),
+  allocated_bytes_(0)
+  {}
+
+  ~monotonic_arena() {
+    for (auto& chunk: chunks_) ::operator delete(chunk.data);
+  }
+
+  monotonic_arena(const monotonic_arena&) = delete;
+  monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+  /**
+   * Allocates a block from the arena
+   * @param bytes size of the block
+   * @param alignment alignment of the block (must be a power of 2)
+   * @return pointer to the block
+   */
+  void* allocate(size_t bytes, size_t alignment) {
+    while (current_ < chunks_.size()) {
+      chunk& c = chunks_[current_];
+      const size_t start = align(reinterpret_cast<uintptr_t>(c.data) + offset_, alignment) - reinterpret_cast<uintptr_t>(c.data);
+      if (start + bytes <= c.size) {
+        offset_ = start + bytes;
+        allocated_bytes_ += bytes;
+        return c.data + start;
+      }
+      ++current_;
+      offset_ = 0;
+    }
+    // operator new returns memory aligned for any fundamental type, extra space covers larger alignment
+    const size_t size = std::max(chunk_bytes_, bytes + alignment);
+    chunks_.push_back(chunk {static_cast<char*>(::operator new(size)), size});
+    current_ = chunks_.size() - 1;
+    chunk& c = chunks_[current_];
+    const size_t start = align(reinterpret_cast<uintptr_t>(c.data), alignment) - reinterpret_cast<uintptr_t>(c.data);
+    offset_ = start + bytes;
+    allocated_bytes_ += bytes;
+    return c.data + start;
+  }
+
+  /**
+   * Makes all memory of the arena available again. Chunks are kept for reuse.
+   * No object allocated from this arena may be used after this call.
+   */
+  void reset() {
+    current_ = 0;
+    offset_ = 0;
+    allocated_bytes_ = 0;
+  }
+
+  /**
+   * @return number of bytes handed out since construction or the last reset
+   */
+  size_t get_allocated_bytes() const { return allocated_bytes_; }
+
+  /**
+   * @return number of bytes obtained from the system
+   */
+  size_t get_reserved_bytes() const {
+    size_t total = 0;
+    for (const auto& c: chunks_) total += c.size;
+    return total;
+  }
+
+private:
+  struct chunk {
+    char* data;
+    size_t size;
+  };
+
+  static uintptr_t align(uintptr_t ptr, size_t alignment) {
+    return (ptr + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+  }
+
+  size_t chunk_bytes_;
+  size_t current_;
+  size_t offset_;
+  size_t allocated_bytes_;
+  std::vector<chunk> chunks_;
+};
+
+/**
+ * Allocator backed by a monotonic_arena, for use as the allocator template parameter of sketches.
+ * deallocate() does nothing: memory is reclaimed by monotonic_arena::reset().
+ * Allocators are equal if they refer to the same arena.
+ */
+template<typename T>
+class arena_allocator {
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template<typename U>
+  struct rebind { using other = arena_allocator<U>; };
+
+  /**
+   * Constructor
+   * @param arena arena to allocate from, which must outlive all allocators and objects using it
+   */
+  explicit arena_allocator(monotonic_arena& arena): arena_(&arena) {}
+
+  template<typename U>
+  arena_allocator(const arena_allocator<U>& other): arena_(other.get_arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, size_t) {}
+
+  monotonic_arena* get_arena() const { return arena_; }
+
+private:
+  monotonic_arena* arena_;
+};
+
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+  return a.get_arena() == b.get_arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>& a, const arena_allocator<U>& b) {
+  return !(a == b);
+}
+
+} /* namespace datasketches */
+
+#endif // _ARENA_ALLOCATOR_HPP_
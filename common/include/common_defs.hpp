@@ -26,6 +26,8 @@
 #include <iostream>
 #include <random>
 #include <chrono>
+#include <thread>
+#include <functional>
 
 namespace datasketches {
 
@@ -36,17 +38,147 @@ enum resize_factor { X1 = 0, X2, X4, X8 };
 template<typename A> using AllocChar = typename std::allocator_traits<A>::template rebind_alloc<char>;
 template<typename A> using string = std::basic_string<char, std::char_traits<char>, AllocChar<A>>;
 
-// random bit
-static std::independent_bits_engine<std::mt19937, 1, uint32_t>
-  random_bit(static_cast<uint32_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+#if defined(__GNUC__) || defined(__clang__)
+#define DATASKETCHES_DEPRECATED(message) __attribute__((deprecated(message)))
+#elif defined(_MSC_VER)
+#define DATASKETCHES_DEPRECATED(message) __declspec(deprecated(message))
+#else
+#define DATASKETCHES_DEPRECATED(message)
+#endif
 
 // common random declarations
+// The random state is per thread, so that sketches can be updated concurrently on different threads,
+// and it can be seeded with override_seed() to make runs on the calling thread reproducible.
 namespace random_utils {
-  static std::random_device rd; // possibly unsafe in MinGW with GCC < 9.2
-  static std::mt19937_64 rand(rd());
-  static std::uniform_real_distribution<> next_double(0.0, 1.0);
+
+  // xoshiro256++ generator seeded using splitmix64
+  // satisfies the UniformRandomBitGenerator requirements to be used with the standard distributions
+  class xoshiro256pp {
+  public:
+    using result_type = uint64_t;
+    explicit xoshiro256pp(uint64_t seed) { this->seed(seed); }
+    void seed(uint64_t seed) {
+      for (auto& word: state_) word = splitmix64(seed);
+    }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+    result_type operator()() {
+      const uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+      const uint64_t t = state_[1] << 17;
+      state_[2] ^= state_[0];
+      state_[3] ^= state_[1];
+      state_[1] ^= state_[2];
+      state_[0] ^= state_[3];
+      state_[2] ^= t;
+      state_[3] = rotl(state_[3], 45);
+      return result;
+    }
+  private:
+    uint64_t state_[4];
+    static inline uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    static inline uint64_t splitmix64(uint64_t& x) {
+      uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+    }
+  };
+
+  // hands out the bits of generated words one at a time
+  class random_bit_generator {
+  public:
+    explicit random_bit_generator(uint64_t seed): engine_(seed), bits_(0), num_bits_(0) {}
+    void seed(uint64_t seed) {
+      engine_.seed(seed);
+      num_bits_ = 0;
+    }
+    uint32_t operator()() {
+      if (num_bits_ == 0) {
+        bits_ = engine_();
+        num_bits_ = 64;
+      }
+      const uint32_t bit = bits_ & 1;
+      bits_ >>= 1;
+      --num_bits_;
+      return bit;
+    }
+  private:
+    xoshiro256pp engine_;
+    uint64_t bits_;
+    uint8_t num_bits_;
+  };
+
+  // differs between runs and between threads
+  static inline uint64_t make_seed(const void* thread_state) {
+    return static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())
+      ^ static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()))
+      ^ static_cast<uint64_t>(reinterpret_cast<uintptr_t>(thread_state));
+  }
+
+  // random engine of the calling thread
+  inline xoshiro256pp& engine() {
+    static thread_local xoshiro256pp engine(make_seed(&engine));
+    return engine;
+  }
+
+  inline random_bit_generator& bit_generator() {
+    static thread_local random_bit_generator generator(make_seed(&generator));
+    return generator;
+  }
+
+  inline uint32_t random_bit() {
+    return bit_generator()();
+  }
+
+  // uniform in [0, 1)
+  inline double next_double() {
+    return std::uniform_real_distribution<>(0.0, 1.0)(engine());
+  }
+
+  // makes the random choices of sketches updated on the calling thread reproducible
+  inline void override_seed(uint64_t seed) {
+    engine().seed(seed);
+    bit_generator().seed(~seed);
+  }
+
+  // undoes override_seed() with a new seed that differs between runs
+  inline void reset_seed() {
+    override_seed(make_seed(&engine()));
+  }
+
+  // forwards to the engine of the calling thread
+  class thread_engine {
+  public:
+    using result_type = xoshiro256pp::result_type;
+    static constexpr result_type min() { return xoshiro256pp::min(); }
+    static constexpr result_type max() { return xoshiro256pp::max(); }
+    result_type operator()() const { return engine()(); }
+  };
+
+  // the global generators used before the random state was per thread
+
+  DATASKETCHES_DEPRECATED("use random_utils::engine()")
+  static const thread_engine rand{};
+
+  template<typename G>
+  DATASKETCHES_DEPRECATED("use random_utils::next_double()")
+  inline double next_double(G& generator) {
+    return std::uniform_real_distribution<>(0.0, 1.0)(generator);
+  }
 }
 
+// forwards to the bit generator of the calling thread
+class thread_random_bit {
+public:
+  using result_type = uint32_t;
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 1; }
+  result_type operator()() const { return random_utils::random_bit(); }
+};
+
+DATASKETCHES_DEPRECATED("use random_utils::random_bit()")
+static const thread_random_bit random_bit{};
+
 
 // utility function to hide unused compiler warning
 // usually has no additional cost
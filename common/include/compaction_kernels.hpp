@@ -0,0 +1,315 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef _COMPACTION_KERNELS_HPP_
+#define _COMPACTION_KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DATASKETCHES_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace datasketches {
+
+/**
+ * Kernels for the compaction step of the KLL and classic quantiles sketches with arithmetic items:
+ * keeping every other item of a sorted run, and merging two sorted runs.
+ * With SSE2 the decimation shuffles 128-bit registers, and the merge of float, double and int32_t items
+ * in ascending order goes through a bitonic merge network.
+ * Other types and comparators take the scalar path. Items are never converted,
+ * so the output is always a permutation of the input bits (including signed zeros and NaNs).
+ * The scalar merge is stable, the merge network is not: items that compare equal but differ in bits,
+ * such as -0.0 and +0.0, may come out in a different order in SSE2 builds than in scalar builds.
+ */
+namespace compaction_kernels {
+
+// arithmetic types that are decimated with register shuffles
+template<typename T>
+struct is_supported: std::integral_constant<bool, std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+namespace detail {
+
+template<typename T, typename C>
+struct merge_network {
+  static const bool available = false;
+};
+
+#ifdef DATASKETCHES_SSE2
+
+template<size_t Size> struct shuffle;
+
+template<>
+struct shuffle<4> {
+  static const size_t lanes = 4;
+  static inline __m128i even(__m128i a, __m128i b) {
+    return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+  }
+};
+
+template<>
+struct shuffle<8> {
+  static const size_t lanes = 2;
+  static inline __m128i even(__m128i a, __m128i b) {
+    return _mm_unpacklo_epi64(a, b);
+  }
+};
+
+// lo gets the minimums and hi the maximums
+// the operand order makes every pair a permutation of the inputs even for equal items
+struct float_exchange {
+  static inline void apply(__m128& lo, __m128& hi) {
+    const __m128 min = _mm_min_ps(lo, hi);
+    hi = _mm_max_ps(hi, lo);
+    lo = min;
+  }
+};
+
+struct int32_exchange {
+  static inline void apply(__m128& lo, __m128& hi) {
+    const __m128i a = _mm_castps_si128(lo);
+    const __m128i b = _mm_castps_si128(hi);
+    const __m128i diff = _mm_and_si128(_mm_xor_si128(a, b), _mm_cmpgt_epi32(a, b));
+    lo = _mm_castsi128_ps(_mm_xor_si128(a, diff));
+    hi = _mm_castsi128_ps(_mm_xor_si128(b, diff));
+  }
+};
+
+template<typename T, typename Exchange>
+struct four_lane_network {
+  static const bool available = true;
+  static const size_t lanes = 4;
+  using vector = __m128;
+
+  static inline vector load(const T* ptr) {
+    return _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+  }
+
+  static inline void store(T* ptr, vector v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm_castps_si128(v));
+  }
+
+  // lo and hi are sorted, afterwards lo has the lower half of the items and hi the upper half, both sorted
+  static inline void merge(vector& lo, vector& hi) {
+    hi = _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(0, 1, 2, 3));
+    Exchange::apply(lo, hi);
+    // two bitonic sequences of 4, compare at distance 2
+    vector x = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(1, 0, 1, 0));
+    vector y = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 2, 3, 2));
+    Exchange::apply(x, y);
+    // then at distance 1, which leaves positions 0 4 2 6 in x and 1 5 3 7 in y
+    lo = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+    hi = _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1));
+    Exchange::apply(lo, hi);
+    x = _mm_unpacklo_ps(lo, hi);
+    y = _mm_unpackhi_ps(lo, hi);
+    lo = _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 0, 1, 0));
+    hi = _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 2, 3, 2));
+  }
+};
+
+struct double_network {
+  static const bool available = true;
+  static const size_t lanes = 2;
+  using vector = __m128d;
+
+  static inline vector load(const double* ptr) { return _mm_loadu_pd(ptr); }
+  static inline void store(double* ptr, vector v) { _mm_storeu_pd(ptr, v); }
+
+  static inline void exchange(vector& lo, vector& hi) {
+    const vector min = _mm_min_pd(lo, hi);
+    hi = _mm_max_pd(hi, lo);
+    lo = min;
+  }
+
+  static inline void merge(vector& lo, vector& hi) {
+    hi = _mm_shuffle_pd(hi, hi, 1);
+    exchange(lo, hi);
+    vector x = _mm_unpacklo_pd(lo, hi);
+    vector y = _mm_unpackhi_pd(lo, hi);
+    exchange(x, y);
+    lo = _mm_unpacklo_pd(x, y);
+    hi = _mm_unpackhi_pd(x, y);
+  }
+};
+
+template<>
+struct merge_network<float, std::less<float>>: four_lane_network<float, float_exchange> {};
+
+template<>
+struct merge_network<int32_t, std::less<int32_t>>: four_lane_network<int32_t, int32_exchange> {};
+
+template<>
+struct merge_network<double, std::less<double>>: double_network {};
+
+#endif // DATASKETCHES_SSE2
+
+template<typename T>
+void decimate(const T* src, T* dst, size_t num, std::false_type) {
+  for (size_t i = 0; i < num; ++i) dst[i] = src[2 * i];
+}
+
+template<typename T>
+void decimate_backward(const T* src, T* dst, size_t num, std::false_type) {
+  for (size_t i = num; i > 0; --i) dst[i - 1] = src[2 * (i - 1)];
+}
+
+#ifdef DATASKETCHES_SSE2
+
+// each block reads 2 * lanes items from src before writing lanes items to dst
+// the last item is left to the scalar loop so that the reads stay within src[0, 2 * num - 1)
+// going backward, a block reads no further than src[2 * i - 1] and everything written so far
+// is at dst[i] or above, so the reads see the original items as long as dst >= src + num - 1
+
+template<typename T>
+void decimate(const T* src, T* dst, size_t num, std::true_type) {
+  using S = shuffle<sizeof(T)>;
+  size_t i = 0;
+  for (; i + S::lanes < num; i += S::lanes) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i + S::lanes));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), S::even(a, b));
+  }
+  decimate(src + 2 * i, dst + i, num - i, std::false_type());
+}
+
+template<typename T>
+void decimate_backward(const T* src, T* dst, size_t num, std::true_type) {
+  using S = shuffle<sizeof(T)>;
+  if (num == 0) return;
+  size_t i = num - 1;
+  dst[i] = src[2 * i];
+  for (; i >= S::lanes; i -= S::lanes) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * (i - S::lanes)));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i - S::lanes));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i - S::lanes), S::even(a, b));
+  }
+  decimate_backward(src, dst, i, std::false_type());
+}
+
+#else
+
+template<typename T>
+void decimate(const T* src, T* dst, size_t num, std::true_type) {
+  decimate(src, dst, num, std::false_type());
+}
+
+template<typename T>
+void decimate_backward(const T* src, T* dst, size_t num, std::true_type) {
+  decimate_backward(src, dst, num, std::false_type());
+}
+
+#endif // DATASKETCHES_SSE2
+
+template<typename T, typename C>
+void merge(const T* a, size_t len_a, const T* b, size_t len_b, T* dst, std::false_type) {
+  const T* const end_a = a + len_a;
+  const T* const end_b = b + len_b;
+  while (a != end_a && b != end_b) *dst++ = C()(*b, *a) ? *b++ : *a++;
+  while (a != end_a) *dst++ = *a++;
+  while (b != end_b) *dst++ = *b++;
+}
+
+// the network holds the largest lanes items merged so far in hi, and outputs the rest
+// the next block comes from the run with the smaller next item
+template<typename T, typename C>
+void merge(const T* a, size_t len_a, const T* b, size_t len_b, T* dst, std::true_type) {
+  using N = merge_network<T, C>;
+  const size_t lanes = N::lanes;
+  if (len_a < lanes || len_b < lanes) return merge<T, C>(a, len_a, b, len_b, dst, std::false_type());
+  const T* const end_a = a + len_a;
+  const T* const end_b = b + len_b;
+  typename N::vector lo = N::load(a);
+  typename N::vector hi = N::load(b);
+  a += lanes;
+  b += lanes;
+  N::merge(lo, hi);
+  N::store(dst, lo);
+  dst += lanes;
+  while (static_cast<size_t>(end_a - a) >= lanes && static_cast<size_t>(end_b - b) >= lanes) {
+    if (C()(*b, *a)) {
+      lo = N::load(b);
+      b += lanes;
+    } else {
+      lo = N::load(a);
+      a += lanes;
+    }
+    N::merge(lo, hi);
+    N::store(dst, lo);
+    dst += lanes;
+  }
+  // the held items are merged with the run that has less than lanes items left, then with the other run
+  T held[lanes];
+  T head[2 * lanes];
+  N::store(held, hi);
+  if (static_cast<size_t>(end_a - a) < lanes) {
+    merge<T, C>(held, lanes, a, end_a - a, head, std::false_type());
+    merge<T, C>(head, lanes + (end_a - a), b, end_b - b, dst, std::false_type());
+  } else {
+    merge<T, C>(held, lanes, b, end_b - b, head, std::false_type());
+    merge<T, C>(a, end_a - a, head, lanes + (end_b - b), dst, std::false_type());
+  }
+}
+
+} /* namespace detail */
+
+// ascending comparators of the types that have a merge network
+template<typename T, typename C>
+struct has_merge_network: std::integral_constant<bool, detail::merge_network<T, C>::available> {};
+
+/**
+ * Copies every other item: dst[i] = src[2 * i] for i in [0, num).
+ * The buffers may overlap if dst <= src, as when a run is halved down in place.
+ */
+template<typename T>
+void decimate(const T* src, T* dst, size_t num) {
+  detail::decimate(src, dst, num, is_supported<T>());
+}
+
+/**
+ * The same as decimate(), going from the end, so that the buffers may overlap if dst >= src + num - 1,
+ * as when a run of 2 * num items is halved up in place into its upper half.
+ * Any closer overlap overwrites items before they are read, in the scalar loop as well as in the SSE2 path.
+ */
+template<typename T>
+void decimate_backward(const T* src, T* dst, size_t num) {
+  detail::decimate_backward(src, dst, num, is_supported<T>());
+}
+
+/**
+ * Merges sorted runs a and b into dst.
+ * dst may overlap b if it is the gap in front of b that fits the items of a,
+ * as in the in-place compaction of the KLL sketch.
+ * The result is sorted, but the order of equal items (such as signed zeros) depends on the build,
+ * so the items that a compaction keeps may differ in the sign of zero between SSE2 and scalar builds.
+ */
+template<typename T, typename C>
+void merge(const T* a, size_t len_a, const T* b, size_t len_b, T* dst) {
+  detail::merge<T, C>(a, len_a, b, len_b, dst, has_merge_network<T, C>());
+}
+
+} /* namespace compaction_kernels */
+
+} /* namespace datasketches */
+
+#endif
@@ -101,12 +101,17 @@ static inline uint8_t count_trailing_zeros_in_u32(uint32_t input) {
 }
 
 static inline uint8_t count_trailing_zeros_in_u64(uint64_t input) {
+#if defined(__GNUC__) || defined(__clang__)
+  if (input != 0) return static_cast<uint8_t>(__builtin_ctzll(input));
+  return 64;
+#else
   for (int i = 0; i < 8; i++) {
     const int byte = input & 0xff;
     if (byte != 0) return static_cast<uint8_t>((i << 3) + byte_trailing_zeros_table[byte]);
     input >>= 8;
   }
   return 64;
+#endif
 }
 
 } /* namespace datasketches */
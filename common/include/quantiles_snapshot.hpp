@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef QUANTILES_SNAPSHOT_HPP_
+#define QUANTILES_SNAPSHOT_HPP_
+
+#include <type_traits>
+#include <vector>
+
+#include "quantiles_sorted_view.hpp"
+
+namespace datasketches {
+
+/**
+ * Immutable query object of a KLL, classic quantiles or REQ sketch, obtained by freeze().
+ * It holds the sorted view of the sketch together with copies of the retained items,
+ * so it does not depend on the sketch, which can be updated or destroyed afterwards.
+ * All queries are const and have no side effects, so one snapshot can be shared by any number of reader threads.
+ */
+template<
+  typename T,
+  typename Comparator, // strict weak ordering function (see C++ named requirements: Compare)
+  typename Allocator
+>
+class quantiles_snapshot {
+public:
+  using sorted_view = quantiles_sorted_view<T, Comparator, Allocator>;
+  using quantile_return_type = typename sorted_view::quantile_return_type;
+  using vector_double = typename sorted_view::vector_double;
+  using const_iterator = typename sorted_view::const_iterator;
+
+  /**
+   * Constructor, used by freeze() of the sketches
+   * @param view sorted view of the sketch
+   * @param n number of items presented to the sketch
+   * @param min_item pointer to the minimum item, or nullptr if the sketch is empty
+   * @param max_item pointer to the maximum item, or nullptr if the sketch is empty
+   * @param allocator to allocate the copies of the items
+   */
+  quantiles_snapshot(sorted_view&& view, uint64_t n, const T* min_item, const T* max_item, const Allocator& allocator);
+
+  quantiles_snapshot(const quantiles_snapshot& other);
+  quantiles_snapshot(quantiles_snapshot&& other) = default;
+
+  // immutable
+  quantiles_snapshot& operator=(const quantiles_snapshot&) = delete;
+  quantiles_snapshot& operator=(quantiles_snapshot&&) = delete;
+
+  bool is_empty() const;
+  uint64_t get_n() const;
+  uint32_t get_num_retained() const;
+
+  /**
+   * @return the minimum item of the stream
+   * If the sketch was empty this throws std::runtime_error.
+   */
+  const T& get_min_item() const;
+
+  /**
+   * @return the maximum item of the stream
+   * If the sketch was empty this throws std::runtime_error.
+   */
+  const T& get_max_item() const;
+
+  /**
+   * The same as get_rank() of the sketch
+   */
+  double get_rank(const T& item, bool inclusive = true) const;
+
+  /**
+   * The same as get_ranks() of the sketch
+   */
+  vector_double get_ranks(const T* items, uint32_t size, bool inclusive = true) const;
+
+  /**
+   * The same as get_quantile() of the sketch
+   */
+  quantile_return_type get_quantile(double rank, bool inclusive = true) const;
+
+  /**
+   * The same as get_quantiles() of the sketch
+   */
+  std::vector<T, Allocator> get_quantiles(const double* ranks, uint32_t size, bool inclusive = true) const;
+
+  /**
+   * The same as get_PMF() of the sketch
+   */
+  vector_double get_PMF(const T* split_points, uint32_t size, bool inclusive = true) const;
+
+  /**
+   * The same as get_CDF() of the sketch
+   */
+  vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
+
+  const sorted_view& get_sorted_view() const;
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  uint64_t n_;
+  std::vector<T, Allocator> items_; // copies of the retained items in sorted order if the view refers to items
+  std::vector<T, Allocator> min_max_; // empty if the sketch was empty
+  sorted_view view_;
+
+  // the view keeps arithmetic items by value and other items by pointer
+  void copy_items(std::true_type);
+  void copy_items(std::false_type);
+  void point_to_items(std::true_type);
+  void point_to_items(std::false_type);
+
+  static void check_rank(double rank);
+};
+
+} /* namespace datasketches */
+
+#include "quantiles_snapshot_impl.hpp"
+
+#endif
@@ -0,0 +1,160 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef QUANTILES_SNAPSHOT_IMPL_HPP_
+#define QUANTILES_SNAPSHOT_IMPL_HPP_
+
+#include <stdexcept>
+
+namespace datasketches {
+
+template<typename T, typename C, typename A>
+quantiles_snapshot<T, C, A>::quantiles_snapshot(sorted_view&& view, uint64_t n, const T* min_item, const T* max_item,
+    const A& allocator):
+n_(n),
+items_(allocator),
+min_max_(allocator),
+view_(std::move(view))
+{
+  if (min_item != nullptr && max_item != nullptr) {
+    min_max_.reserve(2);
+    min_max_.push_back(*min_item);
+    min_max_.push_back(*max_item);
+  }
+  copy_items(std::is_arithmetic<T>());
+}
+
+template<typename T, typename C, typename A>
+quantiles_snapshot<T, C, A>::quantiles_snapshot(const quantiles_snapshot& other):
+n_(other.n_),
+items_(other.items_),
+min_max_(other.min_max_),
+view_(other.view_)
+{
+  point_to_items(std::is_arithmetic<T>());
+}
+
+template<typename T, typename C, typename A>
+void quantiles_snapshot<T, C, A>::copy_items(std::true_type) {}
+
+template<typename T, typename C, typename A>
+void quantiles_snapshot<T, C, A>::copy_items(std::false_type) {
+  items_.reserve(view_.entries_.size());
+  for (const auto& entry: view_.entries_) items_.push_back(*entry.first);
+  point_to_items(std::false_type());
+}
+
+template<typename T, typename C, typename A>
+void quantiles_snapshot<T, C, A>::point_to_items(std::true_type) {}
+
+template<typename T, typename C, typename A>
+void quantiles_snapshot<T, C, A>::point_to_items(std::false_type) {
+  for (size_t i = 0; i < items_.size(); ++i) view_.entries_[i].first = &items_[i];
+}
+
+template<typename T, typename C, typename A>
+bool quantiles_snapshot<T, C, A>::is_empty() const {
+  return n_ == 0;
+}
+
+template<typename T, typename C, typename A>
+uint64_t quantiles_snapshot<T, C, A>::get_n() const {
+  return n_;
+}
+
+template<typename T, typename C, typename A>
+uint32_t quantiles_snapshot<T, C, A>::get_num_retained() const {
+  return static_cast<uint32_t>(view_.size());
+}
+
+template<typename T, typename C, typename A>
+const T& quantiles_snapshot<T, C, A>::get_min_item() const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return min_max_[0];
+}
+
+template<typename T, typename C, typename A>
+const T& quantiles_snapshot<T, C, A>::get_max_item() const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return min_max_[1];
+}
+
+template<typename T, typename C, typename A>
+double quantiles_snapshot<T, C, A>::get_rank(const T& item, bool inclusive) const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return view_.get_rank(item, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::get_ranks(const T* items, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return view_.get_ranks(items, size, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::get_quantile(double rank, bool inclusive) const -> quantile_return_type {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  check_rank(rank);
+  return view_.get_quantile(rank, inclusive);
+}
+
+template<typename T, typename C, typename A>
+std::vector<T, A> quantiles_snapshot<T, C, A>::get_quantiles(const double* ranks, uint32_t size, bool inclusive) const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  for (uint32_t i = 0; i < size; ++i) check_rank(ranks[i]);
+  return view_.get_quantiles(ranks, size, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::get_PMF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return view_.get_PMF(split_points, size, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return view_.get_CDF(split_points, size, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::get_sorted_view() const -> const sorted_view& {
+  return view_;
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::begin() const -> const_iterator {
+  return view_.begin();
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_snapshot<T, C, A>::end() const -> const_iterator {
+  return view_.end();
+}
+
+template<typename T, typename C, typename A>
+void quantiles_snapshot<T, C, A>::check_rank(double rank) {
+  if ((rank < 0.0) || (rank > 1.0)) {
+    throw std::invalid_argument("Normalized rank cannot be less than 0 or greater than 1");
+  }
+}
+
+} /* namespace datasketches */
+
+#endif
@@ -27,6 +27,8 @@
 
 namespace datasketches {
 
+template<typename T, typename C, typename A> class quantiles_snapshot;
+
 template<
   typename T,
   typename Comparator, // strict weak ordering function (see C++ named requirements: Compare)
@@ -40,9 +42,16 @@ public:
 
   quantiles_sorted_view(uint32_t num, const Comparator& comparator, const Allocator& allocator);
 
+  // adds a sorted run of items with the given weight
+  // runs are only collected here, and merged by convert_to_cummulative()
   template<typename Iterator>
   void add(Iterator begin, Iterator end, uint64_t weight);
 
+  // adds a run of items in any order, which is sorted here, so that the sketch is not modified by queries
+  template<typename Iterator>
+  void add_unsorted(Iterator begin, Iterator end, uint64_t weight);
+
+  // merges all runs in one pass and computes the cumulative weights
   void convert_to_cummulative();
 
   class const_iterator;
@@ -60,10 +69,61 @@ public:
   vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
   vector_double get_PMF(const T* split_points, uint32_t size, bool inclusive = true) const;
 
+  // batch forms of get_rank() and get_quantile()
+  // sorted inputs are answered in one forward scan over the view, others by branchless binary search
+  vector_double get_ranks(const T* items, uint32_t size, bool inclusive = true) const;
+  std::vector<T, Allocator> get_quantiles(const double* ranks, uint32_t size, bool inclusive = true) const;
+
+  // validates split points for get_CDF() and get_PMF(), also for views of sketches that do not build a sorted view
+  template<typename TT = T, typename std::enable_if<std::is_floating_point<TT>::value, int>::type = 0>
+  static inline void check_split_points(const T* items, uint32_t size) {
+    for (uint32_t i = 0; i < size ; i++) {
+      if (std::isnan(items[i])) {
+        throw std::invalid_argument("Values must not be NaN");
+      }
+      if ((i < (size - 1)) && !(Comparator()(items[i], items[i + 1]))) {
+        throw std::invalid_argument("Values must be unique and monotonically increasing");
+      }
+    }
+  }
+
+  template<typename TT = T, typename std::enable_if<!std::is_floating_point<TT>::value, int>::type = 0>
+  static inline void check_split_points(const T* items, uint32_t size) {
+    for (uint32_t i = 0; i < size ; i++) {
+      if ((i < (size - 1)) && !(Comparator()(items[i], items[i + 1]))) {
+        throw std::invalid_argument("Items must be unique and monotonically increasing");
+      }
+    }
+  }
+
 private:
+  using AllocSize = typename std::allocator_traits<Allocator>::template rebind_alloc<size_t>;
+
+  // a snapshot points the entries to its own copies of the items
+  friend class quantiles_snapshot<T, Comparator, Allocator>;
+
   Comparator comparator_;
   uint64_t total_weight_;
   Container entries_;
+  std::vector<size_t, AllocSize> run_ends_; // ends of the sorted runs in entries_ before the merge
+
+  void merge_runs();
+
+  // index of the first entry for which the predicate is false, the entries being partitioned by it
+  template<typename Predicate>
+  size_t partition_point(size_t first, size_t last, Predicate pred) const;
+  // the same, knowing that the predicate is true before first, searching forward from there
+  template<typename Predicate>
+  size_t partition_point_from(size_t first, Predicate pred) const;
+
+  // the batch queries are instantiated for each predicate to keep the search loops branchless
+  template<typename Predicate>
+  void add_ranks(const T* items, uint32_t size, vector_double& ranks) const;
+  template<typename Predicate>
+  void add_quantiles(const double* ranks, uint32_t size, bool inclusive, std::vector<T, Allocator>& quantiles) const;
+
+  double get_rank_at(size_t index) const;
+  uint64_t get_target_weight(double rank, bool inclusive) const;
 
   static inline const T& deref_helper(const T* t) { return *t; }
   static inline T deref_helper(T t) { return t; }
@@ -82,6 +142,34 @@ private:
     }
   };
 
+  // predicates for entries before the position of an item, as in get_rank()
+  struct entry_not_greater_than_item {
+    entry_not_greater_than_item(const Comparator& comparator, const T& item): comparator_(comparator), item_(item) {}
+    bool operator()(const Entry& entry) const { return !comparator_(item_, deref_helper(entry.first)); }
+    const Comparator& comparator_;
+    const T& item_;
+  };
+
+  struct entry_less_than_item {
+    entry_less_than_item(const Comparator& comparator, const T& item): comparator_(comparator), item_(item) {}
+    bool operator()(const Entry& entry) const { return comparator_(deref_helper(entry.first), item_); }
+    const Comparator& comparator_;
+    const T& item_;
+  };
+
+  // predicates for entries before the quantile of a given weight, as in get_quantile()
+  struct weight_less_than {
+    explicit weight_less_than(uint64_t weight): weight_(weight) {}
+    bool operator()(const Entry& entry) const { return entry.second < weight_; }
+    uint64_t weight_;
+  };
+
+  struct weight_not_greater_than {
+    explicit weight_not_greater_than(uint64_t weight): weight_(weight) {}
+    bool operator()(const Entry& entry) const { return entry.second <= weight_; }
+    uint64_t weight_;
+  };
+
   template<typename TT = T, typename std::enable_if<std::is_arithmetic<TT>::value, int>::type = 0>
   static inline T ref_helper(const T& t) { return t; }
 
@@ -93,27 +181,6 @@ private:
 
   template<typename TT = T, typename std::enable_if<!std::is_arithmetic<TT>::value, int>::type = 0>
   static inline Entry make_dummy_entry(uint64_t weight) { return Entry(nullptr, weight); }
-
-  template<typename TT = T, typename std::enable_if<std::is_floating_point<TT>::value, int>::type = 0>
-  static inline void check_split_points(const T* items, uint32_t size) {
-    for (uint32_t i = 0; i < size ; i++) {
-      if (std::isnan(items[i])) {
-        throw std::invalid_argument("Values must not be NaN");
-      }
-      if ((i < (size - 1)) && !(Comparator()(items[i], items[i + 1]))) {
-        throw std::invalid_argument("Values must be unique and monotonically increasing");
-      }
-    }
-  }
-
-  template<typename TT = T, typename std::enable_if<!std::is_floating_point<TT>::value, int>::type = 0>
-  static inline void check_split_points(const T* items, uint32_t size) {
-    for (uint32_t i = 0; i < size ; i++) {
-      if ((i < (size - 1)) && !(Comparator()(items[i], items[i + 1]))) {
-        throw std::invalid_argument("Items must be unique and monotonically increasing");
-      }
-    }
-  }
 };
 
 template<typename T, typename C, typename A>
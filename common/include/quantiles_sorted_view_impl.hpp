@@ -23,6 +23,8 @@
 #include <algorithm>
 #include <stdexcept>
 #include <cmath>
+#include <iterator>
+#include <utility>
 
 namespace datasketches {
 
@@ -30,7 +32,8 @@ template<typename T, typename C, typename A>
 quantiles_sorted_view<T, C, A>::quantiles_sorted_view(uint32_t num, const C& comparator, const A& allocator):
 comparator_(comparator),
 total_weight_(0),
-entries_(allocator)
+entries_(allocator),
+run_ends_(allocator)
 {
   entries_.reserve(num);
 }
@@ -40,42 +43,87 @@ template<typename Iterator>
 void quantiles_sorted_view<T, C, A>::add(Iterator first, Iterator last, uint64_t weight) {
   const size_t size_before = entries_.size();
   for (auto it = first; it != last; ++it) entries_.push_back(Entry(ref_helper(*it), weight));
-  if (size_before > 0) {
-    Container tmp(entries_.get_allocator());
-    tmp.reserve(entries_.capacity());
-    std::merge(
-        entries_.begin(), entries_.begin() + size_before,
-        entries_.begin() + size_before, entries_.end(),
-        std::back_inserter(tmp), compare_pairs_by_first(comparator_)
-    );
-    std::swap(tmp, entries_);
-  }
+  if (entries_.size() > size_before) run_ends_.push_back(entries_.size());
+}
+
+template<typename T, typename C, typename A>
+template<typename Iterator>
+void quantiles_sorted_view<T, C, A>::add_unsorted(Iterator first, Iterator last, uint64_t weight) {
+  const size_t size_before = entries_.size();
+  add(first, last, weight);
+  std::sort(entries_.begin() + size_before, entries_.end(), compare_pairs_by_first(comparator_));
 }
 
 template<typename T, typename C, typename A>
 void quantiles_sorted_view<T, C, A>::convert_to_cummulative() {
+  if (run_ends_.size() > 1) merge_runs();
+  std::vector<size_t, AllocSize>(run_ends_.get_allocator()).swap(run_ends_);
   for (auto& entry: entries_) {
     total_weight_ += entry.second;
     entry.second = total_weight_;
   }
 }
 
+// Merges the sorted runs in place, always taking the adjacent pair with the smallest total size.
+// This moves close to the minimal number of entries both when the run sizes grow geometrically
+// (KLL levels) and when they are equal (classic quantiles levels).
+// Merging only adjacent runs keeps equal items in the order of the runs, as with one std::merge after another.
+// The left run is moved to a scratch buffer, which is allocated once, and merged forward with the right run.
+// The output never passes the next unread entry of the right run, so no entry is overwritten before it is read.
+template<typename T, typename C, typename A>
+void quantiles_sorted_view<T, C, A>::merge_runs() {
+  Container scratch(entries_.get_allocator());
+  while (run_ends_.size() > 1) {
+    size_t best = 0;
+    size_t best_size = 0;
+    for (size_t i = 0; i + 1 < run_ends_.size(); ++i) {
+      const size_t begin = i == 0 ? 0 : run_ends_[i - 1];
+      const size_t size = run_ends_[i + 1] - begin;
+      if (i == 0 || size < best_size) {
+        best = i;
+        best_size = size;
+      }
+    }
+    const size_t begin = best == 0 ? 0 : run_ends_[best - 1];
+    const size_t middle = run_ends_[best];
+    const size_t end = run_ends_[best + 1];
+    scratch.assign(std::make_move_iterator(entries_.begin() + begin), std::make_move_iterator(entries_.begin() + middle));
+    const compare_pairs_by_first compare(comparator_);
+    auto left = scratch.begin();
+    auto right = entries_.begin() + middle;
+    const auto right_end = entries_.begin() + end;
+    auto out = entries_.begin() + begin;
+    while (left != scratch.end() && right != right_end) {
+      // equal items are taken from the left run first
+      if (compare(*right, *left)) *out++ = std::move(*right++);
+      else *out++ = std::move(*left++);
+    }
+    std::move(left, scratch.end(), out); // the rest of the right run is already in place
+    run_ends_.erase(run_ends_.begin() + best);
+  }
+}
+
 template<typename T, typename C, typename A>
 double quantiles_sorted_view<T, C, A>::get_rank(const T& item, bool inclusive) const {
   if (entries_.empty()) throw std::runtime_error("operation is undefined for an empty sketch");
   auto it = inclusive ?
       std::upper_bound(entries_.begin(), entries_.end(), Entry(ref_helper(item), 0), compare_pairs_by_first(comparator_))
     : std::lower_bound(entries_.begin(), entries_.end(), Entry(ref_helper(item), 0), compare_pairs_by_first(comparator_));
+  return get_rank_at(it - entries_.begin());
+}
+
+// normalized rank of items before the entry with the given index
+template<typename T, typename C, typename A>
+double quantiles_sorted_view<T, C, A>::get_rank_at(size_t index) const {
   // we need item just before
-  if (it == entries_.begin()) return 0;
-  --it;
-  return static_cast<double>(it->second) / total_weight_;
+  if (index == 0) return 0;
+  return static_cast<double>(entries_[index - 1].second) / total_weight_;
 }
 
 template<typename T, typename C, typename A>
 auto quantiles_sorted_view<T, C, A>::get_quantile(double rank, bool inclusive) const -> quantile_return_type {
   if (entries_.empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  uint64_t weight = inclusive ? std::ceil(rank * total_weight_) : rank * total_weight_;
+  const uint64_t weight = get_target_weight(rank, inclusive);
   auto it = inclusive ?
       std::lower_bound(entries_.begin(), entries_.end(), make_dummy_entry<T>(weight), compare_pairs_by_second())
     : std::upper_bound(entries_.begin(), entries_.end(), make_dummy_entry<T>(weight), compare_pairs_by_second());
@@ -83,14 +131,100 @@ auto quantiles_sorted_view<T, C, A>::get_quantile(double rank, bool inclusive) c
   return deref_helper(it->first);
 }
 
+template<typename T, typename C, typename A>
+uint64_t quantiles_sorted_view<T, C, A>::get_target_weight(double rank, bool inclusive) const {
+  return inclusive ? std::ceil(rank * total_weight_) : rank * total_weight_;
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_sorted_view<T, C, A>::get_ranks(const T* items, uint32_t size, bool inclusive) const -> vector_double {
+  if (entries_.empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  vector_double ranks(entries_.get_allocator());
+  ranks.reserve(size);
+  if (inclusive) add_ranks<entry_not_greater_than_item>(items, size, ranks);
+  else add_ranks<entry_less_than_item>(items, size, ranks);
+  return ranks;
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_sorted_view<T, C, A>::get_quantiles(const double* ranks, uint32_t size, bool inclusive) const -> std::vector<T, A> {
+  if (entries_.empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  std::vector<T, A> quantiles(entries_.get_allocator());
+  quantiles.reserve(size);
+  if (inclusive) add_quantiles<weight_less_than>(ranks, size, inclusive, quantiles);
+  else add_quantiles<weight_not_greater_than>(ranks, size, inclusive, quantiles);
+  return quantiles;
+}
+
+template<typename T, typename C, typename A>
+template<typename Predicate>
+void quantiles_sorted_view<T, C, A>::add_ranks(const T* items, uint32_t size, vector_double& ranks) const {
+  if (std::is_sorted(items, items + size, comparator_)) {
+    size_t index = 0;
+    for (uint32_t i = 0; i < size; ++i) {
+      index = partition_point_from(index, Predicate(comparator_, items[i]));
+      ranks.push_back(get_rank_at(index));
+    }
+  } else {
+    for (uint32_t i = 0; i < size; ++i) {
+      ranks.push_back(get_rank_at(partition_point(0, entries_.size(), Predicate(comparator_, items[i]))));
+    }
+  }
+}
+
+template<typename T, typename C, typename A>
+template<typename Predicate>
+void quantiles_sorted_view<T, C, A>::add_quantiles(const double* ranks, uint32_t size, bool inclusive, std::vector<T, A>& quantiles) const {
+  const bool sorted = std::is_sorted(ranks, ranks + size);
+  size_t index = 0;
+  for (uint32_t i = 0; i < size; ++i) {
+    const Predicate pred(get_target_weight(ranks[i], inclusive));
+    index = sorted ? partition_point_from(index, pred) : partition_point(0, entries_.size(), pred);
+    // past the end means the last item, as in get_quantile()
+    quantiles.push_back(deref_helper(entries_[std::min(index, entries_.size() - 1)].first));
+  }
+}
+
+// Branchless binary search: the loop has a fixed number of iterations for a given length,
+// and the conditional update of the position compiles to a conditional move.
+template<typename T, typename C, typename A>
+template<typename Predicate>
+size_t quantiles_sorted_view<T, C, A>::partition_point(size_t first, size_t last, Predicate pred) const {
+  if (first == last) return first;
+  const Entry* base = entries_.data() + first;
+  size_t length = last - first;
+  while (length > 1) {
+    const size_t half = length / 2;
+    base += pred(base[half]) ? half : 0;
+    length -= half;
+  }
+  return (base - entries_.data()) + (pred(*base) ? 1 : 0);
+}
+
+// Exponential search forward from the previous position, so that a sorted batch costs
+// about the same as one scan over the view when the batch is large,
+// and a few binary searches when it is small.
+template<typename T, typename C, typename A>
+template<typename Predicate>
+size_t quantiles_sorted_view<T, C, A>::partition_point_from(size_t first, Predicate pred) const {
+  const size_t size = entries_.size();
+  size_t step = 1;
+  size_t last = first;
+  while (last < size && pred(entries_[last])) {
+    first = last + 1;
+    last = first + step;
+    step *= 2;
+  }
+  return partition_point(first, std::min(last, size), pred);
+}
+
 template<typename T, typename C, typename A>
 auto quantiles_sorted_view<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (entries_.empty()) throw std::runtime_error("operation is undefined for an empty sketch");
   vector_double buckets(entries_.get_allocator());
   if (entries_.size() == 0) return buckets;
   check_split_points(split_points, size);
-  buckets.reserve(size + 1);
-  for (uint32_t i = 0; i < size; ++i) buckets.push_back(get_rank(split_points[i], inclusive));
+  buckets = get_ranks(split_points, size, inclusive);
   buckets.push_back(1);
   return buckets;
 }
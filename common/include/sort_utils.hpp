@@ -0,0 +1,203 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef _SORT_UTILS_HPP_
+#define _SORT_UTILS_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace datasketches {
+
+/**
+ * Sorting of the item buffers of the quantiles sketches (KLL level zero, the classic quantiles base buffer,
+ * REQ compactors). Arithmetic items in the order of std::less are sorted by an LSD radix sort
+ * on unsigned keys that have the same order, other items by std::sort with the sketch comparator.
+ *
+ * The sketches drop NaN in update(), so a floating point buffer has no NaN to sort.
+ * Should one get there anyway, it is placed before or after all numbers according to its sign bit,
+ * where std::sort would leave the order undefined.
+ * -0.0 is placed before +0.0, which std::less considers equivalent.
+ */
+namespace sort_utils {
+
+// below this number of items per byte of the key, std::sort is faster than counting 256 digits for each byte
+static const size_t RADIX_SORT_MIN_ITEMS_PER_PASS = 32;
+
+// order preserving map of items to unsigned keys
+template<typename T, typename Enable = void>
+struct radix_key {
+  static const bool supported = false;
+};
+
+template<typename T>
+struct radix_key<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) <= 8)>::type> {
+  static const bool supported = true;
+  using type = typename std::conditional<(sizeof(T) <= 4), uint32_t, uint64_t>::type;
+  // flipping the sign bit puts negative items first
+  static const type flip = std::is_signed<T>::value ? static_cast<type>(1) << (8 * sizeof(type) - 1) : 0;
+  static inline type encode(T item) { return static_cast<type>(item) ^ flip; }
+  static inline T decode(type key) { return static_cast<T>(key ^ flip); }
+};
+
+template<typename T>
+struct radix_key<T, typename std::enable_if<std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)>::type> {
+  static const bool supported = true;
+  using type = typename std::conditional<(sizeof(T) == 4), uint32_t, uint64_t>::type;
+  static const type sign = static_cast<type>(1) << (8 * sizeof(type) - 1);
+  // negative items have all bits flipped to reverse their order, the others only the sign bit
+  static inline type encode(T item) {
+    type bits;
+    std::memcpy(&bits, &item, sizeof(T));
+    return (bits & sign) ? ~bits : bits | sign;
+  }
+  static inline T decode(type key) {
+    const type bits = (key & sign) ? key ^ sign : ~key;
+    T item;
+    std::memcpy(&item, &bits, sizeof(T));
+    return item;
+  }
+};
+
+template<typename T, typename C>
+struct use_radix_sort: std::integral_constant<bool, radix_key<T>::supported && std::is_same<C, std::less<T>>::value> {};
+
+// key type of the radix sort, or a placeholder for the items it does not sort
+template<typename T, bool = radix_key<T>::supported>
+struct radix_key_type { using type = uint8_t; };
+
+template<typename T>
+struct radix_key_type<T, true> { using type = typename radix_key<T>::type; };
+
+/**
+ * Scratch space of the radix sort, which a sketch can keep between calls to sort() to avoid allocating each time.
+ * It grows to the largest number of items sorted so far.
+ */
+template<typename T, typename A>
+using sort_scratch = std::vector<typename radix_key_type<T>::type,
+    typename std::allocator_traits<A>::template rebind_alloc<typename radix_key_type<T>::type>>;
+
+/**
+ * Sorts arithmetic items in ascending order with one counting pass per byte of the key,
+ * skipping the bytes that are the same in all items.
+ * Needs scratch space for two keys per item.
+ * @param first pointer to the first item
+ * @param last pointer past the last item, at most 2^32 - 1 items in total
+ * @param keys scratch space, resized if it has fewer than two keys per item
+ */
+template<typename T, typename AK>
+void radix_sort(T* first, T* last, std::vector<typename radix_key<T>::type, AK>& keys) {
+  using K = radix_key<T>;
+  using Key = typename K::type;
+  const size_t length = last - first;
+  if (length < 2) return;
+  const unsigned num_passes = sizeof(Key);
+  uint32_t counts[sizeof(Key)][256];
+  std::fill(&counts[0][0], &counts[0][0] + num_passes * 256, 0);
+  if (keys.size() < 2 * length) keys.resize(2 * length);
+  Key* src = keys.data();
+  Key* dst = src + length;
+  for (size_t i = 0; i < length; i++) {
+    const Key key = K::encode(first[i]);
+    src[i] = key;
+    for (unsigned pass = 0; pass < num_passes; pass++) counts[pass][(key >> (8 * pass)) & 0xff]++;
+  }
+  for (unsigned pass = 0; pass < num_passes; pass++) {
+    uint32_t* count = counts[pass];
+    if (count[(src[0] >> (8 * pass)) & 0xff] == length) continue;
+    uint32_t offset = 0;
+    for (unsigned digit = 0; digit < 256; digit++) {
+      const uint32_t n = count[digit];
+      count[digit] = offset;
+      offset += n;
+    }
+    for (size_t i = 0; i < length; i++) {
+      const Key key = src[i];
+      dst[count[(key >> (8 * pass)) & 0xff]++] = key;
+    }
+    std::swap(src, dst);
+  }
+  for (size_t i = 0; i < length; i++) first[i] = K::decode(src[i]);
+}
+
+/**
+ * The same as above with temporary scratch space.
+ * @param first pointer to the first item
+ * @param last pointer past the last item, at most 2^32 - 1 items in total
+ * @param allocator to allocate the scratch space
+ */
+template<typename T, typename A>
+void radix_sort(T* first, T* last, const A& allocator) {
+  sort_scratch<T, A> keys(allocator);
+  radix_sort(first, last, keys);
+}
+
+// the scratch space is either an allocator or a sort_scratch
+template<typename T, typename C, typename S>
+void sort(T* first, T* last, const C& comparator, S&, std::false_type) {
+  std::sort(first, last, comparator);
+}
+
+template<typename T, typename C, typename S>
+void sort(T* first, T* last, const C& comparator, S& scratch, std::true_type) {
+  const size_t length = last - first;
+  if (length < RADIX_SORT_MIN_ITEMS_PER_PASS * sizeof(typename radix_key<T>::type)
+      || length > std::numeric_limits<uint32_t>::max()) {
+    std::sort(first, last, comparator);
+  } else {
+    radix_sort(first, last, scratch);
+  }
+}
+
+/**
+ * Sorts items with the given comparator, by radix_sort() if the items are arithmetic,
+ * the comparator is std::less and there are enough of them, otherwise by std::sort.
+ * @param first pointer to the first item
+ * @param last pointer past the last item
+ * @param comparator strict weak ordering of the items
+ * @param allocator to allocate the scratch space of the radix sort
+ */
+template<typename T, typename C, typename A>
+void sort(T* first, T* last, const C& comparator, const A& allocator) {
+  sort(first, last, comparator, allocator, use_radix_sort<T, C>());
+}
+
+/**
+ * The same as above, with the scratch space of the radix sort kept by the caller.
+ * @param first pointer to the first item
+ * @param last pointer past the last item
+ * @param comparator strict weak ordering of the items
+ * @param scratch sort_scratch for the item type, grown as needed
+ */
+template<typename T, typename C, typename K, typename AK>
+void sort(T* first, T* last, const C& comparator, std::vector<K, AK>& scratch) {
+  sort(first, last, comparator, scratch, use_radix_sort<T, C>());
+}
+
+} /* namespace sort_utils */
+
+} /* namespace datasketches */
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "arena_allocator.hpp"
+
+namespace datasketches {
+
+TEST_CASE("arena: alignment", "[arena]") {
+  monotonic_arena arena(256);
+  arena.allocate(1, 1);
+  void* p8 = arena.allocate(8, 8);
+  REQUIRE(reinterpret_cast<uintptr_t>(p8) % 8 == 0);
+  arena.allocate(3, 1);
+  void* p64 = arena.allocate(16, 64);
+  REQUIRE(reinterpret_cast<uintptr_t>(p64) % 64 == 0);
+  REQUIRE(arena.get_allocated_bytes() == 28);
+}
+
+TEST_CASE("arena: large block", "[arena]") {
+  monotonic_arena arena(64);
+  arena.allocate(10, 1);
+  arena.allocate(1000, 8);
+  REQUIRE(arena.get_allocated_bytes() == 1010);
+  REQUIRE(arena.get_reserved_bytes() >= 1064);
+}
+
+TEST_CASE("arena: reset reuses chunks", "[arena]") {
+  monotonic_arena arena(1024);
+  for (int i = 0; i < 3; ++i) {
+    std::vector<uint64_t, arena_allocator<uint64_t>> v{arena_allocator<uint64_t>(arena)};
+    for (uint64_t j = 0; j < 1000; ++j) v.push_back(j);
+    REQUIRE(v[999] == 999);
+    const size_t reserved = arena.get_reserved_bytes();
+    v.clear();
+    v.shrink_to_fit();
+    arena.reset();
+    REQUIRE(arena.get_allocated_bytes() == 0);
+    std::vector<uint64_t, arena_allocator<uint64_t>> v2{arena_allocator<uint64_t>(arena)};
+    for (uint64_t j = 0; j < 1000; ++j) v2.push_back(j);
+    REQUIRE(arena.get_reserved_bytes() == reserved);
+    arena.reset();
+  }
+}
+
+TEST_CASE("arena: allocator equality", "[arena]") {
+  monotonic_arena arena1;
+  monotonic_arena arena2;
+  arena_allocator<int> a1(arena1);
+  arena_allocator<char> a1c(a1);
+  arena_allocator<int> a2(arena2);
+  REQUIRE(a1 == a1c);
+  REQUIRE(a1 != a2);
+}
+
+} /* namespace datasketches */
@@ -0,0 +1,118 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "compaction_kernels.hpp"
+
+namespace datasketches {
+
+template<typename T>
+static void check_decimate() {
+  for (size_t num = 0; num < 40; ++num) {
+    std::vector<T> src(2 * num);
+    for (size_t i = 0; i < src.size(); ++i) src[i] = static_cast<T>(i);
+    std::vector<T> dst(num);
+    compaction_kernels::decimate(src.data(), dst.data(), num);
+    for (size_t i = 0; i < num; ++i) REQUIRE(dst[i] == src[2 * i]);
+
+    // halving down and up within one buffer, as the KLL sketch does
+    // halving up with offset 0 is the closest overlap that decimate_backward allows
+    for (size_t offset = 0; offset < 2; ++offset) {
+      std::vector<T> buf(src);
+      compaction_kernels::decimate(buf.data() + offset, buf.data(), num);
+      for (size_t i = 0; i < num; ++i) REQUIRE(buf[i] == src[2 * i + offset]);
+      buf = src;
+      compaction_kernels::decimate_backward(buf.data() + 1 - offset, buf.data() + num, num);
+      for (size_t i = 0; i < num; ++i) REQUIRE(buf[num + i] == src[2 * i + 1 - offset]);
+    }
+  }
+}
+
+TEST_CASE("compaction kernels: decimate", "[compaction_kernels]") {
+  check_decimate<float>();
+  check_decimate<double>();
+  check_decimate<int32_t>();
+  check_decimate<int64_t>();
+  check_decimate<uint16_t>();
+}
+
+template<typename T, typename C>
+static void check_merge(std::mt19937_64& rng, size_t len_a, size_t len_b) {
+  std::uniform_int_distribution<int> dist(-50, 50);
+  std::vector<T> a(len_a);
+  std::vector<T> b(len_b);
+  for (auto& item: a) item = static_cast<T>(dist(rng));
+  for (auto& item: b) item = static_cast<T>(dist(rng));
+  std::sort(a.begin(), a.end(), C());
+  std::sort(b.begin(), b.end(), C());
+  std::vector<T> expected(len_a + len_b);
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin(), C());
+
+  std::vector<T> dst(len_a + len_b);
+  compaction_kernels::merge<T, C>(a.data(), len_a, b.data(), len_b, dst.data());
+  REQUIRE(dst == expected);
+
+  // a, then a gap for a, then b, merged into the gap as in the in-place compaction
+  std::vector<T> buf(a);
+  buf.resize(2 * len_a);
+  buf.insert(buf.end(), b.begin(), b.end());
+  compaction_kernels::merge<T, C>(buf.data(), len_a, buf.data() + 2 * len_a, len_b, buf.data() + len_a);
+  REQUIRE(std::equal(expected.begin(), expected.end(), buf.begin() + len_a));
+}
+
+template<typename T, typename C = std::less<T>>
+static void check_merge() {
+  std::mt19937_64 rng(1);
+  for (size_t len_a = 0; len_a < 20; ++len_a) {
+    for (size_t len_b = 0; len_b < 20; ++len_b) {
+      check_merge<T, C>(rng, len_a, len_b);
+    }
+  }
+  check_merge<T, C>(rng, 1000, 3000);
+  check_merge<T, C>(rng, 3001, 999);
+}
+
+TEST_CASE("compaction kernels: merge", "[compaction_kernels]") {
+  check_merge<float>();
+  check_merge<double>();
+  check_merge<int32_t>();
+  check_merge<int64_t>();
+  check_merge<float, std::greater<float>>();
+  check_merge<uint32_t>();
+}
+
+TEST_CASE("compaction kernels: merge keeps signed zeros", "[compaction_kernels]") {
+  const std::vector<float> a {-1, -0.0f, 0, 0, 2};
+  const std::vector<float> b {-0.0f, -0.0f, 0, 1, 3};
+  std::vector<float> dst(a.size() + b.size());
+  compaction_kernels::merge<float, std::less<float>>(a.data(), a.size(), b.data(), b.size(), dst.data());
+  REQUIRE(std::is_sorted(dst.begin(), dst.end()));
+  REQUIRE(std::count_if(dst.begin(), dst.end(), [](float x) { return x == 0 && std::signbit(x); }) == 3);
+  REQUIRE(std::count_if(dst.begin(), dst.end(), [](float x) { return x == 0 && !std::signbit(x); }) == 3);
+}
+
+} /* namespace datasketches */
@@ -19,8 +19,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <string>
 #include <vector>
 #include <utility>
+#include <algorithm>
 
 #include <iostream>
 
@@ -35,6 +37,9 @@ TEST_CASE("empty", "sorted view") {
   const float split_points[1] {0};
   REQUIRE_THROWS_AS(view.get_CDF(split_points, 1), std::runtime_error);
   REQUIRE_THROWS_AS(view.get_PMF(split_points, 1), std::runtime_error);
+  REQUIRE_THROWS_AS(view.get_ranks(split_points, 1), std::runtime_error);
+  const double ranks[1] {0};
+  REQUIRE_THROWS_AS(view.get_quantiles(ranks, 1), std::runtime_error);
 }
 
 TEST_CASE("set 0", "sorted view") {
@@ -456,4 +461,100 @@ TEST_CASE("set 4", "sorted view") {
     REQUIRE(view.get_quantile(1, false) == 40);
 }
 
+TEST_CASE("many runs", "sorted view") {
+  // runs with duplicate items across runs and some empty runs
+  std::vector<std::vector<int>> runs;
+  for (int r = 0; r < 20; r++) {
+    std::vector<int> run;
+    for (int i = 0; i < (r % 4) * 5; i++) run.push_back((i * (r + 3)) % 17);
+    std::sort(run.begin(), run.end());
+    runs.push_back(run);
+  }
+
+  // reference: stable sort keeps the order of runs for equal items, as the pairwise merge did
+  std::vector<std::pair<int, uint64_t>> expected;
+  for (size_t r = 0; r < runs.size(); r++) {
+    for (int item: runs[r]) expected.push_back(std::make_pair(item, uint64_t(1) << r));
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+      [](const std::pair<int, uint64_t>& a, const std::pair<int, uint64_t>& b) { return a.first < b.first; });
+
+  auto view = quantiles_sorted_view<int, std::less<int>, std::allocator<int>>(1, std::less<int>(), std::allocator<int>());
+  for (size_t r = 0; r < runs.size(); r++) view.add(runs[r].begin(), runs[r].end(), uint64_t(1) << r);
+  view.convert_to_cummulative();
+  REQUIRE(view.size() == expected.size());
+  uint64_t cumulative_weight = 0;
+  auto it = view.begin();
+  for (const auto& entry: expected) {
+    cumulative_weight += entry.second;
+    REQUIRE(it->first == entry.first);
+    REQUIRE(it.get_weight() == entry.second);
+    REQUIRE(it.get_cumulative_weight() == cumulative_weight);
+    ++it;
+  }
+  REQUIRE(it == view.end());
+  REQUIRE(view.get_rank(16) == 1);
+}
+
+TEST_CASE("many equal-weight runs with duplicates", "sorted view") {
+  // equal run sizes make the merge pick pairs in the middle, and strings would expose entries read after being moved
+  std::vector<std::vector<std::string>> runs;
+  for (int r = 0; r < 16; r++) {
+    std::vector<std::string> run;
+    for (int i = 0; i < 32; i++) run.push_back(std::to_string((i * (r + 5)) % 7));
+    std::sort(run.begin(), run.end());
+    runs.push_back(run);
+  }
+
+  // reference: all entries sorted at once, as before the runs were merged
+  std::vector<std::string> expected;
+  for (const auto& run: runs) expected.insert(expected.end(), run.begin(), run.end());
+  std::sort(expected.begin(), expected.end());
+
+  auto view = quantiles_sorted_view<std::string, std::less<std::string>, std::allocator<std::string>>(1, std::less<std::string>(), std::allocator<std::string>());
+  for (const auto& run: runs) view.add(run.begin(), run.end(), 3);
+  view.convert_to_cummulative();
+  REQUIRE(view.size() == expected.size());
+  uint64_t cumulative_weight = 0;
+  auto it = view.begin();
+  for (const auto& item: expected) {
+    cumulative_weight += 3;
+    REQUIRE(it->first == item);
+    REQUIRE(it.get_weight() == 3);
+    REQUIRE(it.get_cumulative_weight() == cumulative_weight);
+    ++it;
+  }
+  REQUIRE(it == view.end());
+}
+
+TEST_CASE("batch queries", "sorted view") {
+  auto view = quantiles_sorted_view<std::string, std::less<std::string>, std::allocator<std::string>>(1, std::less<std::string>(), std::allocator<std::string>());
+  std::vector<std::string> l0 {"b", "d", "d", "f"};
+  std::vector<std::string> l1 {"a", "d", "h"};
+  view.add(l0.begin(), l0.end(), 1);
+  view.add(l1.begin(), l1.end(), 2);
+  view.convert_to_cummulative();
+
+  // sorted and unsorted, with items below, between, equal to and above the retained ones
+  const std::vector<std::string> sorted_items {"", "a", "a", "c", "d", "e", "h", "z"};
+  const std::vector<std::string> unsorted_items {"e", "", "z", "d", "a", "h", "c", "d"};
+  for (bool inclusive: {true, false}) {
+    for (const auto& items: {sorted_items, unsorted_items}) {
+      const auto ranks = view.get_ranks(items.data(), items.size(), inclusive);
+      REQUIRE(ranks.size() == items.size());
+      for (size_t i = 0; i < items.size(); ++i) REQUIRE(ranks[i] == view.get_rank(items[i], inclusive));
+    }
+
+    std::vector<double> sorted_ranks;
+    for (int i = 0; i <= 40; ++i) sorted_ranks.push_back(i / 40.0);
+    std::vector<double> unsorted_ranks(sorted_ranks.rbegin(), sorted_ranks.rend());
+    std::swap(unsorted_ranks[3], unsorted_ranks[30]);
+    for (const auto& ranks: {sorted_ranks, unsorted_ranks}) {
+      const auto quantiles = view.get_quantiles(ranks.data(), ranks.size(), inclusive);
+      REQUIRE(quantiles.size() == ranks.size());
+      for (size_t i = 0; i < ranks.size(); ++i) REQUIRE(quantiles[i] == view.get_quantile(ranks[i], inclusive));
+    }
+  }
+}
+
 } /* namespace datasketches */
@@ -0,0 +1,161 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sort_utils.hpp"
+
+namespace datasketches {
+
+template<typename T>
+static void check_radix_sort(const std::vector<T>& items) {
+  std::vector<T> expected(items);
+  std::sort(expected.begin(), expected.end());
+  std::vector<T> sorted(items);
+  sort_utils::radix_sort(sorted.data(), sorted.data() + sorted.size(), std::allocator<T>());
+  REQUIRE(sorted == expected);
+  sorted = items;
+  sort_utils::sort(sorted.data(), sorted.data() + sorted.size(), std::less<T>(), std::allocator<T>());
+  REQUIRE(sorted == expected);
+  sorted = items;
+  sort_utils::sort_scratch<T, std::allocator<T>> scratch;
+  sort_utils::sort(sorted.data(), sorted.data() + sorted.size(), std::less<T>(), scratch);
+  REQUIRE(sorted == expected);
+}
+
+template<typename T>
+static void check_integers() {
+  std::mt19937_64 rng(1);
+  std::uniform_int_distribution<int64_t> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+  for (size_t n: {0, 1, 2, 100, 300, 1000}) {
+    std::vector<T> items(n);
+    for (auto& item: items) item = static_cast<T>(dist(rng));
+    check_radix_sort(items);
+  }
+  // small range of values, so that the upper bytes are skipped
+  std::vector<T> items(1000);
+  for (auto& item: items) item = static_cast<T>(rng() % 100);
+  check_radix_sort(items);
+}
+
+TEST_CASE("sort utils: integers", "[sort_utils]") {
+  check_integers<int8_t>();
+  check_integers<uint8_t>();
+  check_integers<int16_t>();
+  check_integers<uint16_t>();
+  check_integers<int32_t>();
+  check_integers<uint32_t>();
+  check_integers<int64_t>();
+}
+
+TEST_CASE("sort utils: unsigned 64-bit", "[sort_utils]") {
+  std::mt19937_64 rng(2);
+  std::vector<uint64_t> items(1000);
+  for (auto& item: items) item = rng();
+  items[0] = std::numeric_limits<uint64_t>::max();
+  items[1] = 0;
+  check_radix_sort(items);
+}
+
+template<typename T>
+static void check_floating_point() {
+  std::mt19937_64 rng(3);
+  std::uniform_real_distribution<T> dist(-1000, 1000);
+  for (size_t n: {0, 1, 2, 100, 300, 1000}) {
+    std::vector<T> items(n);
+    for (auto& item: items) item = dist(rng);
+    check_radix_sort(items);
+  }
+  std::vector<T> items(1000);
+  for (auto& item: items) item = dist(rng);
+  items[0] = std::numeric_limits<T>::infinity();
+  items[1] = -std::numeric_limits<T>::infinity();
+  items[2] = std::numeric_limits<T>::max();
+  items[3] = std::numeric_limits<T>::lowest();
+  items[4] = std::numeric_limits<T>::denorm_min();
+  items[5] = -std::numeric_limits<T>::denorm_min();
+  items[6] = 0;
+  items[7] = 1;
+  check_radix_sort(items);
+}
+
+TEST_CASE("sort utils: floating point", "[sort_utils]") {
+  check_floating_point<float>();
+  check_floating_point<double>();
+}
+
+TEST_CASE("sort utils: signed zeros", "[sort_utils]") {
+  std::vector<float> items(200);
+  for (size_t i = 0; i < items.size(); ++i) items[i] = (i % 2 == 0) ? 0.0f : -0.0f;
+  items[7] = -1;
+  items[8] = 1;
+  sort_utils::radix_sort(items.data(), items.data() + items.size(), std::allocator<float>());
+  REQUIRE(items.front() == -1);
+  REQUIRE(items.back() == 1);
+  for (size_t i = 1; i < 100; ++i) REQUIRE(std::signbit(items[i]));
+  for (size_t i = 100; i < 199; ++i) REQUIRE_FALSE(std::signbit(items[i]));
+}
+
+TEST_CASE("sort utils: reused scratch", "[sort_utils]") {
+  std::mt19937_64 rng(4);
+  sort_utils::sort_scratch<double, std::allocator<double>> scratch;
+  for (size_t n: {1000, 300, 1000}) {
+    std::vector<double> items(n);
+    for (auto& item: items) item = static_cast<double>(rng() % 10000) - 5000;
+    std::vector<double> expected(items);
+    std::sort(expected.begin(), expected.end());
+    sort_utils::sort(items.data(), items.data() + items.size(), std::less<double>(), scratch);
+    REQUIRE(items == expected);
+    REQUIRE(scratch.size() == 2000); // grown for the largest buffer only
+  }
+
+  // a placeholder for the types the radix sort does not handle
+  sort_utils::sort_scratch<std::string, std::allocator<std::string>> unused;
+  std::vector<std::string> strings {"c", "a", "b"};
+  sort_utils::sort(strings.data(), strings.data() + strings.size(), std::less<std::string>(), unused);
+  REQUIRE(strings == std::vector<std::string>({"a", "b", "c"}));
+  REQUIRE(unused.empty());
+}
+
+TEST_CASE("sort utils: other comparators and types", "[sort_utils]") {
+  REQUIRE_FALSE(sort_utils::use_radix_sort<float, std::greater<float>>::value);
+  REQUIRE_FALSE(sort_utils::use_radix_sort<bool, std::less<bool>>::value);
+  REQUIRE_FALSE(sort_utils::use_radix_sort<std::string, std::less<std::string>>::value);
+  REQUIRE(sort_utils::use_radix_sort<double, std::less<double>>::value);
+
+  std::vector<float> items(1000);
+  for (size_t i = 0; i < items.size(); ++i) items[i] = static_cast<float>(i % 37);
+  sort_utils::sort(items.data(), items.data() + items.size(), std::greater<float>(), std::allocator<float>());
+  REQUIRE(std::is_sorted(items.begin(), items.end(), std::greater<float>()));
+
+  std::vector<std::string> strings {"c", "a", "b"};
+  sort_utils::sort(strings.data(), strings.data() + strings.size(), std::less<std::string>(), std::allocator<std::string>());
+  REQUIRE(strings == std::vector<std::string>({"a", "b", "c"}));
+}
+
+} /* namespace datasketches */
@@ -28,4 +28,8 @@ long long test_allocator_total_bytes = 0;
 // (number of allocations minus number of deallocations)
 long long test_allocator_net_allocations = 0;
 
+// global variable to keep track of the number of allocations
+// (not reduced by deallocations, so temporary buffers are counted too)
+long long test_allocator_allocations = 0;
+
 } /* namespace datasketches */
@@ -30,6 +30,7 @@ namespace datasketches {
 
 extern long long test_allocator_total_bytes;
 extern long long test_allocator_net_allocations;
+extern long long test_allocator_allocations;
 
 template <class T> class test_allocator {
 public:
@@ -70,6 +71,7 @@ public:
     if (!p) throw std::bad_alloc();
     test_allocator_total_bytes += n * sizeof(value_type);
     ++test_allocator_net_allocations;
+    ++test_allocator_allocations;
     return static_cast<pointer>(p);
   }
 
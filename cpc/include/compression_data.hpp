@@ -37,7 +37,7 @@ Some manual cutting and pasting was then done to transfer the contents
 of that file into this one.
 
 Only the encoding tables are defined by this file. The decoding tables (which are exact inverses)
-are created at library startup time.
+are in decompression_data.hpp.
 */
 
 static const uint16_t encoding_tables_for_high_entropy_byte [22][256] = {
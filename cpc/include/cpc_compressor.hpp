@@ -40,7 +40,8 @@ template<typename A> class cpc_sketch_alloc;
 template<typename A> class cpc_compressor;
 
 // the compressor is not instantiated directly
-// the sketch implementation uses this global function to statically allocate and construct on the first use
+// the sketch implementation uses this global function to get a static instance
+// the decoding tables are static data (see decompression_data.hpp), so there is no initialization at run time
 template<typename A>
 inline cpc_compressor<A>& get_compressor();
 
@@ -50,6 +51,11 @@ public:
   void compress(const cpc_sketch_alloc<A>& source, compressed_state<A>& target) const;
   void uncompress(const compressed_state<A>& source, uncompressed_state<A>& target, uint8_t lg_k, uint32_t num_coupons) const;
 
+  // Decodes the sliding window and the row-column pairs without building a hash table.
+  // The window is left empty before PINNED mode, and in HYBRID mode the pairs include the window bits.
+  void uncompress_pairs(const compressed_state<A>& source, vector_u32<A>& pairs, vector_u8<A>& window,
+      uint8_t lg_k, uint32_t num_coupons) const;
+
   // methods below are public for testing
 
   // This returns the number of compressed words that were actually used. It is the caller's
@@ -89,28 +95,8 @@ public:
   ) const;
 
 private:
-  // These decoding tables are created at library startup time by inverting the encoding tables
-  uint16_t* decoding_tables_for_high_entropy_byte[22] = {
-    // sixteen tables for the steady state (chosen based on the "phase" of C/K)
-    NULL, NULL, NULL, NULL,
-    NULL, NULL, NULL, NULL,
-    NULL, NULL, NULL, NULL,
-    NULL, NULL, NULL, NULL,
-    // six more tables for the gradual transition between warmup mode and the steady state.
-    NULL, NULL, NULL, NULL, NULL, NULL
-  };
-  uint16_t* length_limited_unary_decoding_table65;
-  uint8_t* column_permutations_for_decoding[16] = {
-    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
-  };
-
-  cpc_compressor();
+  cpc_compressor() = default;
   template<typename T> friend cpc_compressor<T>& get_compressor();
-  ~cpc_compressor();
-
-  void make_decoding_tables(); // call this at startup
-  void free_decoding_tables(); // call this at the end
 
   void compress_sparse_flavor(const cpc_sketch_alloc<A>& source, compressed_state<A>& target) const;
   void compress_hybrid_flavor(const cpc_sketch_alloc<A>& source, compressed_state<A>& target) const;
@@ -122,19 +108,18 @@ private:
   void uncompress_pinned_flavor(const compressed_state<A>& source, uncompressed_state<A>& target, uint8_t lg_k, uint32_t num_coupons) const;
   void uncompress_sliding_flavor(const compressed_state<A>& source, uncompressed_state<A>& target, uint8_t lg_k, uint32_t num_coupons) const;
 
-  uint8_t* make_inverse_permutation(const uint8_t* permu, unsigned length);
-  uint16_t* make_decoding_table(const uint16_t* encoding_table, unsigned num_byte_values);
-  void validate_decoding_table(const uint16_t* decoding_table, const uint16_t* encoding_table) const;
-
   void compress_surprising_values(const vector_u32<A>& pairs, uint8_t lg_k, compressed_state<A>& result) const;
   void compress_sliding_window(const uint8_t* window, uint8_t lg_k, uint32_t num_coupons, compressed_state<A>& target) const;
 
   vector_u32<A> uncompress_surprising_values(const uint32_t* data, uint32_t data_words, uint32_t num_pairs, uint8_t lg_k, const A& allocator) const;
+  void uncompress_surprising_values(const uint32_t* data, uint32_t data_words, uint32_t num_pairs, uint8_t lg_k, uint32_t* pairs) const;
   void uncompress_sliding_window(const uint32_t* data, uint32_t data_words, vector_u8<A>& window, uint8_t lg_k, uint32_t num_coupons) const;
 
   static size_t safe_length_for_compressed_pair_buf(uint32_t k, uint32_t num_pairs, uint8_t num_base_bits);
   static size_t safe_length_for_compressed_window_buf(uint32_t k);
   static uint8_t determine_pseudo_phase(uint8_t lg_k, uint32_t c);
+  static void undo_pinned_column_shift(uint32_t* pairs, uint32_t num_pairs);
+  static void undo_sliding_column_permutation(uint32_t* pairs, uint32_t num_pairs, uint8_t lg_k, uint32_t num_coupons);
 
   static inline vector_u32<A> tricky_get_pairs_from_window(const uint8_t* window, uint32_t k, uint32_t num_pairs_to_get, uint32_t empty_space, const A& allocator);
   static inline uint8_t golomb_choose_number_of_base_bits(uint32_t k, uint64_t count);
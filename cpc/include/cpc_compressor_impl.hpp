@@ -26,108 +26,18 @@
 #include <stdexcept>
 
 #include "compression_data.hpp"
+#include "decompression_data.hpp"
 #include "cpc_util.hpp"
 #include "cpc_common.hpp"
 #include "count_zeros.hpp"
 
 namespace datasketches {
 
-// construct on first use
+// the compressor has no state, and the decoding tables are static data
 template<typename A>
 cpc_compressor<A>& get_compressor() {
-  static cpc_compressor<A>* instance = new cpc_compressor<A>(); // use new for global initialization
-  return *instance;
-}
-
-template<typename A>
-cpc_compressor<A>::cpc_compressor() {
-  make_decoding_tables();
-}
-
-template<typename A>
-cpc_compressor<A>::~cpc_compressor() {
-  free_decoding_tables();
-}
-
-template<typename A>
-uint8_t* cpc_compressor<A>::make_inverse_permutation(const uint8_t* permu, unsigned length) {
-  uint8_t* inverse = new uint8_t[length]; // use new for global initialization
-  for (unsigned i = 0; i < length; i++) {
-    inverse[permu[i]] = static_cast<uint8_t>(i);
-  }
-  for (unsigned i = 0; i < length; i++) {
-    if (permu[inverse[i]] != i) throw std::logic_error("inverse permutation error");
-  }
-  return inverse;
-}
-
-/* Given an encoding table that maps unsigned bytes to codewords
-   of length at most 12, this builds a size-4096 decoding table */
-// The second argument is typically 256, but can be other values such as 65.
-template<typename A>
-uint16_t* cpc_compressor<A>::make_decoding_table(const uint16_t* encoding_table, unsigned num_byte_values) {
-  uint16_t* decoding_table = new uint16_t[4096]; // use new for global initialization
-  for (unsigned byte_value = 0; byte_value < num_byte_values; byte_value++) {
-    const uint16_t encoding_entry = encoding_table[byte_value];
-    const uint16_t code_value = encoding_entry & 0xfff;
-    const uint8_t code_length = encoding_entry >> 12;
-    const uint16_t decoding_entry = static_cast<uint16_t>((code_length << 8) | byte_value);
-    const uint8_t garbage_length = 12 - code_length;
-    const uint32_t num_copies = 1 << garbage_length;
-    for (uint32_t garbage_bits = 0; garbage_bits < num_copies; garbage_bits++) {
-      const uint16_t extended_code_value = static_cast<uint16_t>(code_value | (garbage_bits << code_length));
-      decoding_table[extended_code_value & 0xfff] = decoding_entry;
-    }
-  }
-  return decoding_table;
-}
-
-template<typename A>
-void cpc_compressor<A>::validate_decoding_table(const uint16_t* decoding_table, const uint16_t* encoding_table) const {
-  for (int decode_this = 0; decode_this < 4096; decode_this++) {
-    const int tmp_d = decoding_table[decode_this];
-    const int decoded_byte = tmp_d & 0xff;
-    const int decoded_length = tmp_d >> 8;
-
-    const int tmp_e = encoding_table[decoded_byte];
-    const int encoded_bit_pattern = tmp_e & 0xfff;
-    const int encoded_length = tmp_e >> 12;
-
-    if (decoded_length != encoded_length) throw std::logic_error("decoded length error");
-    if (encoded_bit_pattern != (decode_this & ((1 << decoded_length) - 1))) throw std::logic_error("bit pattern error");
-  }
-}
-
-template<typename A>
-void cpc_compressor<A>::make_decoding_tables() {
-  length_limited_unary_decoding_table65 = make_decoding_table(length_limited_unary_encoding_table65, 65);
-  validate_decoding_table(
-      length_limited_unary_decoding_table65,
-      length_limited_unary_encoding_table65
-  );
-
-  for (int i = 0; i < (16 + 6); i++) {
-    decoding_tables_for_high_entropy_byte[i] = make_decoding_table(encoding_tables_for_high_entropy_byte[i], 256);
-    validate_decoding_table(
-        decoding_tables_for_high_entropy_byte[i],
-        encoding_tables_for_high_entropy_byte[i]
-    );
-  }
-
-  for (int i = 0; i < 16; i++) {
-    column_permutations_for_decoding[i] = make_inverse_permutation(column_permutations_for_encoding[i], 56);
-  }
-}
-
-template<typename A>
-void cpc_compressor<A>::free_decoding_tables() {
-  delete[] length_limited_unary_decoding_table65;
-  for (int i = 0; i < (16 + 6); i++) {
-    delete[] decoding_tables_for_high_entropy_byte[i];
-  }
-  for (int i = 0; i < 16; i++) {
-    delete[] column_permutations_for_decoding[i];
-  }
+  static cpc_compressor<A> instance;
+  return instance;
 }
 
 template<typename A>
@@ -184,7 +94,7 @@ template<typename A>
 void cpc_compressor<A>::compress_sparse_flavor(const cpc_sketch_alloc<A>& source, compressed_state<A>& result) const {
   if (source.sliding_window.size() > 0) throw std::logic_error("unexpected sliding window");
   vector_u32<A> pairs = source.surprising_value_table.unwrapping_get_items();
-  u32_table<A>::introspective_insertion_sort(pairs.data(), 0, pairs.size());
+  u32_table<A>::sort_items(pairs.data(), pairs.size(), 6 + source.get_lg_k(), pairs.get_allocator());
   compress_surprising_values(pairs, source.get_lg_k(), result);
 }
 
@@ -206,7 +116,7 @@ void cpc_compressor<A>::compress_hybrid_flavor(const cpc_sketch_alloc<A>& source
   const uint32_t k = 1 << source.get_lg_k();
   vector_u32<A> pairs_from_table = source.surprising_value_table.unwrapping_get_items();
   const uint32_t num_pairs_from_table = static_cast<uint32_t>(pairs_from_table.size());
-  if (num_pairs_from_table > 0) u32_table<A>::introspective_insertion_sort(pairs_from_table.data(), 0, num_pairs_from_table);
+  if (num_pairs_from_table > 0) u32_table<A>::sort_items(pairs_from_table.data(), num_pairs_from_table, 6 + source.get_lg_k(), pairs_from_table.get_allocator());
   const uint32_t num_pairs_from_window = source.get_num_coupons() - num_pairs_from_table; // because the window offset is zero
 
   vector_u32<A> all_pairs = tricky_get_pairs_from_window(source.sliding_window.data(), k, num_pairs_from_window, num_pairs_from_table, source.get_allocator());
@@ -262,7 +172,7 @@ void cpc_compressor<A>::compress_pinned_flavor(const cpc_sketch_alloc<A>& source
       pairs[i] -= 8;
     }
 
-    if (pairs.size() > 0) u32_table<A>::introspective_insertion_sort(pairs.data(), 0, pairs.size());
+    if (pairs.size() > 0) u32_table<A>::sort_items(pairs.data(), pairs.size(), 6 + source.get_lg_k(), pairs.get_allocator());
     compress_surprising_values(pairs, source.get_lg_k(), result);
   }
 }
@@ -279,11 +189,7 @@ void cpc_compressor<A>::uncompress_pinned_flavor(const compressed_state<A>& sour
     if (source.table_data.size() == 0) throw std::logic_error("table is expected");
     vector_u32<A> pairs = uncompress_surprising_values(source.table_data.data(), source.table_data_words, num_pairs,
         lg_k, source.table_data.get_allocator());
-    // undo the compressor's 8-column shift
-    for (uint32_t i = 0; i < num_pairs; i++) {
-      if ((pairs[i] & 63) >= 56) throw std::logic_error("(pairs[i] & 63) >= 56");
-      pairs[i] += 8;
-    }
+    undo_pinned_column_shift(pairs.data(), num_pairs);
     target.table = u32_table<A>::make_from_pairs(pairs.data(), num_pairs, lg_k, pairs.get_allocator());
   }
 }
@@ -315,7 +221,7 @@ void cpc_compressor<A>::compress_sliding_flavor(const cpc_sketch_alloc<A>& sourc
       pairs[i] = (row << 6) | col;
     }
 
-    if (pairs.size() > 0) u32_table<A>::introspective_insertion_sort(pairs.data(), 0, pairs.size());
+    if (pairs.size() > 0) u32_table<A>::sort_items(pairs.data(), pairs.size(), 6 + source.get_lg_k(), pairs.get_allocator());
     compress_surprising_values(pairs, source.get_lg_k(), result);
   }
 }
@@ -332,29 +238,64 @@ void cpc_compressor<A>::uncompress_sliding_flavor(const compressed_state<A>& sou
     if (source.table_data.size() == 0) throw std::logic_error("table is expected");
     vector_u32<A> pairs = uncompress_surprising_values(source.table_data.data(), source.table_data_words, num_pairs,
         lg_k, source.table_data.get_allocator());
+    undo_sliding_column_permutation(pairs.data(), num_pairs, lg_k, num_coupons);
+    target.table = u32_table<A>::make_from_pairs(pairs.data(), num_pairs, lg_k, pairs.get_allocator());
+  }
+}
 
-    const uint8_t pseudo_phase = determine_pseudo_phase(lg_k, num_coupons);
-    if (pseudo_phase >= 16) throw std::logic_error("unexpected pseudo phase for sliding flavor");
-    const uint8_t* permutation = column_permutations_for_decoding[pseudo_phase];
+template<typename A>
+void cpc_compressor<A>::undo_pinned_column_shift(uint32_t* pairs, uint32_t num_pairs) {
+  // undo the compressor's 8-column shift
+  for (uint32_t i = 0; i < num_pairs; i++) {
+    if ((pairs[i] & 63) >= 56) throw std::logic_error("(pairs[i] & 63) >= 56");
+    pairs[i] += 8;
+  }
+}
 
-    uint8_t offset = cpc_sketch_alloc<A>::determine_correct_offset(lg_k, num_coupons);
-    if (offset > 56) throw std::out_of_range("offset out of range");
+template<typename A>
+void cpc_compressor<A>::undo_sliding_column_permutation(uint32_t* pairs, uint32_t num_pairs, uint8_t lg_k, uint32_t num_coupons) {
+  const uint8_t pseudo_phase = determine_pseudo_phase(lg_k, num_coupons);
+  if (pseudo_phase >= 16) throw std::logic_error("unexpected pseudo phase for sliding flavor");
+  const uint8_t* permutation = decompression_data::column_permutations_for_decoding[pseudo_phase];
 
-    for (uint32_t i = 0; i < num_pairs; i++) {
-      const uint32_t row_col = pairs[i];
-      const uint32_t row = row_col >> 6;
-      uint8_t col = row_col & 63;
-      // first undo the permutation
-      col = permutation[col];
-      // then undo the rotation: old = (new + (offset+8)) mod 64
-      col = (col + (offset + 8)) & 63;
-      pairs[i] = (row << 6) | col;
-    }
+  uint8_t offset = cpc_sketch_alloc<A>::determine_correct_offset(lg_k, num_coupons);
+  if (offset > 56) throw std::out_of_range("offset out of range");
 
-    target.table = u32_table<A>::make_from_pairs(pairs.data(), num_pairs, lg_k, pairs.get_allocator());
+  for (uint32_t i = 0; i < num_pairs; i++) {
+    const uint32_t row_col = pairs[i];
+    const uint32_t row = row_col >> 6;
+    uint8_t col = row_col & 63;
+    // first undo the permutation
+    col = permutation[col];
+    // then undo the rotation: old = (new + (offset+8)) mod 64
+    col = (col + (offset + 8)) & 63;
+    pairs[i] = (row << 6) | col;
   }
 }
 
+// The pairs come out of the compressed stream sorted by row, and they stay sorted by row
+// after the column transformations are undone. The vectors are resized, so that the caller
+// can reuse them for many sketches without allocating each time.
+template<typename A>
+void cpc_compressor<A>::uncompress_pairs(const compressed_state<A>& source, vector_u32<A>& pairs, vector_u8<A>& window,
+    uint8_t lg_k, uint32_t num_coupons) const {
+  const auto flavor = cpc_sketch_alloc<A>::determine_flavor(lg_k, num_coupons);
+  if (flavor == cpc_sketch_alloc<A>::flavor::PINNED || flavor == cpc_sketch_alloc<A>::flavor::SLIDING) {
+    if (source.window_data.size() == 0) throw std::logic_error("window is expected");
+    uncompress_sliding_window(source.window_data.data(), source.window_data_words, window, lg_k, num_coupons);
+  } else {
+    if (source.window_data.size() > 0) throw std::logic_error("window is not expected");
+    window.clear();
+  }
+  const uint32_t num_pairs = source.table_num_entries;
+  pairs.resize(num_pairs);
+  if (num_pairs == 0) return;
+  if (source.table_data.size() == 0) throw std::logic_error("table is expected");
+  uncompress_surprising_values(source.table_data.data(), source.table_data_words, num_pairs, lg_k, pairs.data());
+  if (flavor == cpc_sketch_alloc<A>::flavor::PINNED) undo_pinned_column_shift(pairs.data(), num_pairs);
+  if (flavor == cpc_sketch_alloc<A>::flavor::SLIDING) undo_sliding_column_permutation(pairs.data(), num_pairs, lg_k, num_coupons);
+}
+
 template<typename A>
 void cpc_compressor<A>::compress_surprising_values(const vector_u32<A>& pairs, uint8_t lg_k, compressed_state<A>& result) const {
   const uint32_t k = 1 << lg_k;
@@ -376,13 +317,19 @@ void cpc_compressor<A>::compress_surprising_values(const vector_u32<A>& pairs, u
 template<typename A>
 vector_u32<A> cpc_compressor<A>::uncompress_surprising_values(const uint32_t* data, uint32_t data_words, uint32_t num_pairs,
     uint8_t lg_k, const A& allocator) const {
-  const uint32_t k = 1 << lg_k;
   vector_u32<A> pairs(num_pairs, 0, allocator);
-  const uint8_t num_base_bits = golomb_choose_number_of_base_bits(k + num_pairs, num_pairs);
-  low_level_uncompress_pairs(pairs.data(), num_pairs, num_base_bits, data, data_words);
+  uncompress_surprising_values(data, data_words, num_pairs, lg_k, pairs.data());
   return pairs;
 }
 
+template<typename A>
+void cpc_compressor<A>::uncompress_surprising_values(const uint32_t* data, uint32_t data_words, uint32_t num_pairs,
+    uint8_t lg_k, uint32_t* pairs) const {
+  const uint32_t k = 1 << lg_k;
+  const uint8_t num_base_bits = golomb_choose_number_of_base_bits(k + num_pairs, num_pairs);
+  low_level_uncompress_pairs(pairs, num_pairs, num_base_bits, data, data_words);
+}
+
 template<typename A>
 void cpc_compressor<A>::compress_sliding_window(const uint8_t* window, uint8_t lg_k, uint32_t num_coupons, compressed_state<A>& target) const {
   const uint32_t k = 1 << lg_k;
@@ -404,7 +351,7 @@ void cpc_compressor<A>::uncompress_sliding_window(const uint32_t* data, uint32_t
   const uint32_t k = 1 << lg_k;
   window.resize(k); // zeroing not needed here (unlike the Hybrid Flavor)
   const uint8_t pseudo_phase = determine_pseudo_phase(lg_k, num_coupons);
-  low_level_uncompress_bytes(window.data(), k, decoding_tables_for_high_entropy_byte[pseudo_phase], data, data_words);
+  low_level_uncompress_bytes(window.data(), k, decompression_data::decoding_tables_for_high_entropy_byte[pseudo_phase], data, data_words);
 }
 
 template<typename A>
@@ -462,13 +409,21 @@ static inline void maybe_flush_bitbuf(uint64_t& bitbuf, uint8_t& bufbits, uint32
   }
 }
 
-static inline void maybe_fill_bitbuf(uint64_t& bitbuf, uint8_t& bufbits, const uint32_t* wordarr, uint32_t& wordindex, uint8_t minbits) {
-  if (bufbits < minbits) {
-    bitbuf |= static_cast<uint64_t>(wordarr[wordindex++]) << bufbits;
+// The decoders keep the bit buffer filled with more than 32 bits, so that several code words can be read
+// between refills. Past the end of the input the buffer is filled with zeros. The words counted in wordindex
+// may therefore exceed the input, and bits_overrun() tells whether any of those zeros were actually consumed.
+static inline void fill_bitbuf(uint64_t& bitbuf, uint8_t& bufbits, const uint32_t* wordarr, uint32_t& wordindex, uint32_t num_words) {
+  while (bufbits <= 32) {
+    if (wordindex < num_words) bitbuf |= static_cast<uint64_t>(wordarr[wordindex]) << bufbits;
+    wordindex++;
     bufbits += 32;
   }
 }
 
+static inline bool bits_overrun(uint8_t bufbits, uint32_t wordindex, uint32_t num_words) {
+  return static_cast<uint64_t>(wordindex) * 32 - bufbits > static_cast<uint64_t>(num_words) * 32;
+}
+
 // This returns the number of compressed words that were actually used.
 // It is the caller's responsibility to ensure that the compressed_words array is long enough.
 template<typename A>
@@ -519,25 +474,37 @@ void cpc_compressor<A>::low_level_uncompress_bytes(
   if (decoding_table == nullptr) throw std::logic_error("decoding_table == NULL");
   if (compressed_words == nullptr) throw std::logic_error("compressed_words == NULL");
 
-  for (uint32_t byte_index = 0; byte_index < num_bytes_to_decode; byte_index++) {
-    maybe_fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, 12); // ensure 12 bits in bit buffer
-
-    const size_t peek12 = bitbuf & 0xfff; // These 12 bits will include an entire Huffman codeword.
-    const uint16_t lookup = decoding_table[peek12];
+  // Code words are at most 12 bits long, so a refill to more than 32 bits is enough for two of them.
+  uint32_t byte_index = 0;
+  for (; byte_index + 1 < num_bytes_to_decode; byte_index += 2) {
+    fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, num_compressed_words);
+
+    const uint16_t lookup0 = decoding_table[bitbuf & 0xfff]; // These 12 bits will include an entire Huffman codeword.
+    const uint8_t code_word_length0 = lookup0 >> 8;
+    bitbuf >>= code_word_length0;
+    const uint16_t lookup1 = decoding_table[bitbuf & 0xfff];
+    const uint8_t code_word_length1 = lookup1 >> 8;
+    bitbuf >>= code_word_length1;
+    bufbits -= code_word_length0 + code_word_length1;
+    byte_array[byte_index] = lookup0 & 0xff;
+    byte_array[byte_index + 1] = lookup1 & 0xff;
+  }
+  if (byte_index < num_bytes_to_decode) {
+    fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, num_compressed_words);
+    const uint16_t lookup = decoding_table[bitbuf & 0xfff];
     const uint8_t code_word_length = lookup >> 8;
-    const uint8_t decoded_byte = lookup & 0xff;
-    byte_array[byte_index] = decoded_byte;
+    byte_array[byte_index] = lookup & 0xff;
     bitbuf >>= code_word_length;
     bufbits -= code_word_length;
   }
-  // Buffer over-run should be impossible unless there is a bug.
-  // However, we might as well check here.
-  if (word_index > num_compressed_words) throw std::logic_error("word_index > num_compressed_words");
+  // Buffer over-run should be impossible unless there is a bug or the input is corrupted.
+  if (bits_overrun(bufbits, word_index, num_compressed_words)) throw std::logic_error("word_index > num_compressed_words");
 }
 
 static inline uint64_t read_unary(
     const uint32_t* compressed_words,
     uint32_t& next_word_index,
+    uint32_t num_compressed_words,
     uint64_t& bitbuf,
     uint8_t& bufbits
 );
@@ -636,17 +603,17 @@ void cpc_compressor<A>::low_level_uncompress_pairs(
   // y_delta_lo (basebits)
 
   for (uint32_t pair_index = 0; pair_index < num_pairs_to_decode; pair_index++) {
-    maybe_fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, 12); // ensure 12 bits in bit buffer
+    fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, num_compressed_words); // at least 33 bits
     const size_t peek12 = bitbuf & 0xfff;
-    const uint16_t lookup = length_limited_unary_decoding_table65[peek12];
+    const uint16_t lookup = decompression_data::length_limited_unary_decoding_table65[peek12];
     const uint8_t code_word_length = lookup >> 8;
     const int8_t x_delta = lookup & 0xff;
     bitbuf >>= code_word_length;
     bufbits -= code_word_length;
 
-    const uint64_t golomb_hi = read_unary(compressed_words, word_index, bitbuf, bufbits);
+    const uint64_t golomb_hi = read_unary(compressed_words, word_index, num_compressed_words, bitbuf, bufbits);
 
-    maybe_fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, num_base_bits); // ensure num_base_bits in bit buffer
+    if (bufbits < num_base_bits) fill_bitbuf(bitbuf, bufbits, compressed_words, word_index, num_compressed_words);
     const uint64_t golomb_lo = bitbuf & golomb_lo_mask;
     bitbuf >>= num_base_bits;
     bufbits -= num_base_bits;
@@ -661,34 +628,30 @@ void cpc_compressor<A>::low_level_uncompress_pairs(
     predicted_row_index = row_index;
     predicted_col_index = col_index + 1;
   }
-  if (word_index > num_compressed_words) throw std::logic_error("word_index > num_compressed_words"); // check for buffer over-run
+  if (bits_overrun(bufbits, word_index, num_compressed_words)) throw std::logic_error("word_index > num_compressed_words"); // check for buffer over-run
 }
 
+// Bits of the buffer above bufbits are always zero, so the code word ends within the buffer if it is not zero.
 uint64_t read_unary(
     const uint32_t* compressed_words,
     uint32_t& next_word_index,
+    uint32_t num_compressed_words,
     uint64_t& bitbuf,
     uint8_t& bufbits
 ) {
   if (compressed_words == nullptr) throw std::logic_error("compressed_words == NULL");
-  size_t subtotal = 0;
-  while (true) {
-    maybe_fill_bitbuf(bitbuf, bufbits, compressed_words, next_word_index, 8); // ensure 8 bits in bit buffer
-
-    const uint8_t peek8 = bitbuf & 0xff; // These 8 bits include either all or part of the Unary codeword
-    const uint8_t trailing_zeros = byte_trailing_zeros_table[peek8];
-
-    if (trailing_zeros > 8) throw std::out_of_range("trailing_zeros out of range");
-    if (trailing_zeros < 8) {
-      bufbits -= 1 + trailing_zeros;
-      bitbuf >>= 1 + trailing_zeros;
-      return subtotal + trailing_zeros;
-    }
-    // The codeword was partial, so read some more
-    subtotal += 8;
-    bufbits -= 8;
-    bitbuf >>= 8;
+  uint64_t subtotal = 0;
+  while (bitbuf == 0) { // The codeword was partial, so read some more
+    subtotal += bufbits;
+    bufbits = 0;
+    if (next_word_index >= num_compressed_words) throw std::logic_error("word_index > num_compressed_words");
+    fill_bitbuf(bitbuf, bufbits, compressed_words, next_word_index, num_compressed_words);
   }
+  const uint8_t trailing_zeros = count_trailing_zeros_in_u64(bitbuf);
+  bitbuf >>= trailing_zeros;
+  bitbuf >>= 1;
+  bufbits -= 1 + trailing_zeros;
+  return subtotal + trailing_zeros;
 }
 
 void write_unary(
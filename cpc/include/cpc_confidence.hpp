@@ -26,6 +26,7 @@
 #include <stdexcept>
 
 #include "cpc_sketch.hpp"
+#include "icon_estimator.hpp"
 
 namespace datasketches {
 
@@ -95,10 +96,10 @@ static const int16_t HIP_HIGH_SIDE_DATA [33] = {   // Empirically measured at N
  5880, 5914, 5953, // 14 1000297
 };                 // lgK numtrials
 
-template<typename A>
-double get_icon_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
-  if (sketch.get_num_coupons() == 0) return 0.0;
-  const int lg_k = sketch.get_lg_k();
+// The following functions take the fields of a sketch, so that they can be used without a sketch instance.
+
+static inline double get_icon_confidence_lb(uint8_t lg_k, uint32_t num_coupons, int kappa) {
+  if (num_coupons == 0) return 0.0;
   const long k = 1 << lg_k;
   if (lg_k < 4) throw std::logic_error("lgk < 4");
   if (kappa < 1 || kappa > 3) throw std::invalid_argument("kappa must be between 1 and 3");
@@ -106,17 +107,15 @@ double get_icon_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
   if (lg_k <= 14) x = ((double) ICON_HIGH_SIDE_DATA[3 * (lg_k - 4) + (kappa - 1)]) / 10000.0;
   const double rel = x / sqrt(k);
   const double eps = kappa * rel;
-  const double est = sketch.get_icon_estimate();
+  const double est = compute_icon_estimate(lg_k, num_coupons);
   double result = est / (1.0 + eps);
-  const double check = sketch.get_num_coupons();
+  const double check = num_coupons;
   if (result < check) result = check;
   return result;
 }
 
-template<typename A>
-double get_icon_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
-  if (sketch.get_num_coupons() == 0) return 0.0;
-  const int lg_k = sketch.get_lg_k();
+static inline double get_icon_confidence_ub(uint8_t lg_k, uint32_t num_coupons, int kappa) {
+  if (num_coupons == 0) return 0.0;
   const long k = 1 << lg_k;
   if (lg_k < 4) throw std::logic_error("lgk < 4");
   if (kappa < 1 || kappa > 3) throw std::invalid_argument("kappa must be between 1 and 3");
@@ -124,15 +123,13 @@ double get_icon_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
   if (lg_k <= 14) x = ((double) ICON_LOW_SIDE_DATA[3 * (lg_k - 4) + (kappa - 1)]) / 10000.0;
   const double rel = x / sqrt(k);
   const double eps = kappa * rel;
-  const double est = sketch.get_icon_estimate();
+  const double est = compute_icon_estimate(lg_k, num_coupons);
   const double result = est / (1.0 - eps);
   return ceil(result); // widening for coverage
 }
 
-template<typename A>
-double get_hip_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
-  if (sketch.get_num_coupons() == 0) return 0.0;
-  const int lg_k = sketch.get_lg_k();
+static inline double get_hip_confidence_lb(uint8_t lg_k, uint32_t num_coupons, double hip_estimate, int kappa) {
+  if (num_coupons == 0) return 0.0;
   const long k = 1 << lg_k;
   if (lg_k < 4) throw std::logic_error("lgk < 4");
   if (kappa < 1 || kappa > 3) throw std::invalid_argument("kappa must be between 1 and 3");
@@ -140,17 +137,14 @@ double get_hip_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
   if (lg_k <= 14) x = ((double) HIP_HIGH_SIDE_DATA[3 * (lg_k - 4) + (kappa - 1)]) / 10000.0;
   const double rel = x / (sqrt((double) k));
   const double eps = ((double) kappa) * rel;
-  const double est = sketch.get_hip_estimate();
-  double result = est / (1.0 + eps);
-  const double check = (double) sketch.get_num_coupons();
+  double result = hip_estimate / (1.0 + eps);
+  const double check = (double) num_coupons;
   if (result < check) result = check;
   return result;
 }
 
-template<typename A>
-double get_hip_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
-  if (sketch.get_num_coupons() == 0) return 0.0;
-  const int lg_k = sketch.get_lg_k();
+static inline double get_hip_confidence_ub(uint8_t lg_k, uint32_t num_coupons, double hip_estimate, int kappa) {
+  if (num_coupons == 0) return 0.0;
   const long k = 1 << lg_k;
   if (lg_k < 4) throw std::logic_error("lgk < 4");
   if (kappa < 1 || kappa > 3) throw std::invalid_argument("kappa must be between 1 and 3");
@@ -158,11 +152,30 @@ double get_hip_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
   if (lg_k <= 14) x = ((double) HIP_LOW_SIDE_DATA[3 * (lg_k - 4) + (kappa - 1)]) / 10000.0;
   const double rel = x / sqrt(k);
   const double eps = kappa * rel;
-  const double est = sketch.get_hip_estimate();
-  const double result = est / (1.0 - eps);
+  const double result = hip_estimate / (1.0 - eps);
   return ceil(result); // widening for coverage
 }
 
+template<typename A>
+double get_icon_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
+  return get_icon_confidence_lb(sketch.get_lg_k(), sketch.get_num_coupons(), kappa);
+}
+
+template<typename A>
+double get_icon_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
+  return get_icon_confidence_ub(sketch.get_lg_k(), sketch.get_num_coupons(), kappa);
+}
+
+template<typename A>
+double get_hip_confidence_lb(const cpc_sketch_alloc<A>& sketch, int kappa) {
+  return get_hip_confidence_lb(sketch.get_lg_k(), sketch.get_num_coupons(), sketch.get_hip_estimate(), kappa);
+}
+
+template<typename A>
+double get_hip_confidence_ub(const cpc_sketch_alloc<A>& sketch, int kappa) {
+  return get_hip_confidence_ub(sketch.get_lg_k(), sketch.get_num_coupons(), sketch.get_hip_estimate(), kappa);
+}
+
 } /* namespace datasketches */
 
 #endif
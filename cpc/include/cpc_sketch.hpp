@@ -47,16 +47,14 @@ namespace datasketches {
 // forward-declarations
 template<typename A> class cpc_sketch_alloc;
 template<typename A> class cpc_union_alloc;
+template<typename A> class wrapped_cpc_sketch_alloc;
 
-// alias with default allocator for convenience
+// aliases with default allocator for convenience
 using cpc_sketch = cpc_sketch_alloc<std::allocator<uint8_t>>;
+using wrapped_cpc_sketch = wrapped_cpc_sketch_alloc<std::allocator<uint8_t>>;
 
-// allocation and initialization of global decompression (decoding) tables
-// call this before anything else if you want to control the initialization time
-// for instance, to have this happen outside of a transaction context
-// otherwise initialization happens on the first use (serialization or deserialization)
-// it is safe to call more than once assuming no race conditions
-// this is not thread safe! neither is the rest of the library
+// this used to allocate and initialize global decompression (decoding) tables
+// the tables are now static data, so this does nothing and is kept for compatibility
 template<typename A> void cpc_init();
 
 template<typename A>
@@ -194,6 +192,24 @@ public:
    */
   void update(const void* value, size_t size);
 
+  /**
+   * Update this sketch with a block of unsigned 64-bit integers.
+   * The result is the same as calling update(uint64_t) for each value in order,
+   * but values are hashed in groups and pairs that cannot change the sketch are dropped early.
+   * @param values pointer to the first value
+   * @param count number of values
+   */
+  void update_batch(const uint64_t* values, size_t count);
+
+  /**
+   * Update this sketch with a block of strings.
+   * The result is the same as calling update(const std::string&) for each value in order.
+   * Empty strings are ignored.
+   * @param values pointer to the first string
+   * @param count number of strings
+   */
+  void update_batch(const std::string* values, size_t count);
+
   /**
    * Returns a human-readable summary of this sketch
    */
@@ -256,6 +272,7 @@ public:
 private:
   static const uint8_t SERIAL_VERSION = 1;
   static const uint8_t FAMILY = 16;
+  static const size_t UPDATE_BATCH_SIZE = 64; // number of hashes computed ahead in batch updates
 
   enum flags { IS_BIG_ENDIAN, IS_COMPRESSED, HAS_HIP, HAS_TABLE, HAS_WINDOW };
 
@@ -270,6 +287,30 @@ private:
     SLIDING  // 27K/8 <= C
   };
 
+  // fields of a serialized sketch and pointers to its compressed data
+  struct serialized_image {
+    uint8_t lg_k;
+    uint8_t first_interesting_column;
+    bool has_hip;
+    bool has_table;
+    bool has_window;
+    uint32_t num_coupons;
+    uint32_t table_num_entries;
+    uint32_t table_data_words;
+    uint32_t window_data_words;
+    double kxp;
+    double hip_est_accum;
+    const char* table_data;
+    const char* window_data;
+    size_t size_bytes;
+  };
+
+  // checks the image and parses its preamble without decompressing
+  static serialized_image parse(const void* bytes, size_t size, uint64_t seed);
+  // the same, but the image may be followed by more bytes
+  static serialized_image parse_prefix(const void* bytes, size_t size, uint64_t seed);
+  static cpc_sketch_alloc<A> uncompress(const serialized_image& image, uint64_t seed, const A& allocator);
+
   uint8_t lg_k;
   uint64_t seed;
   bool was_merged; // is the sketch the result of merging?
@@ -288,6 +329,7 @@ private:
       vector_u8<A>&& window, bool has_hip, double kxp, double hip_est_accum, uint64_t seed);
 
   inline void row_col_update(uint32_t row_col);
+  void row_col_batch_update(uint32_t* row_cols, size_t count);
   inline void update_sparse(uint32_t row_col);
   inline void update_windowed(uint32_t row_col);
   inline void update_hip(uint32_t row_col);
@@ -318,6 +360,81 @@ private:
 
   friend cpc_compressor<A>;
   friend cpc_union_alloc<A>;
+  friend wrapped_cpc_sketch_alloc<A>;
+};
+
+/**
+ * Read-only view of a serialized CPC sketch.
+ * The estimate and bounds are computed from the preamble: the HIP estimate is stored there,
+ * and the ICON estimate needs only lg_k and the number of coupons.
+ * The compressed data is decompressed only if a full sketch is requested with to_sketch(),
+ * for instance to update a union.
+ * The view does not copy the bytes, which must outlive it.
+ */
+template<typename A>
+class wrapped_cpc_sketch_alloc {
+public:
+  /**
+   * This method wraps a serialized sketch. The image is checked the same way as in
+   * cpc_sketch_alloc::deserialize(), except for the compressed data itself.
+   * @param bytes pointer to the array of bytes
+   * @param size the size of the array
+   * @param seed the seed for the hash function that was used to create the sketch
+   * @param allocator instance of an allocator for to_sketch()
+   * @return an instance of the view
+   */
+  static wrapped_cpc_sketch_alloc wrap(const void* bytes, size_t size, uint64_t seed = DEFAULT_SEED, const A& allocator = A());
+
+  /**
+   * @return configured lg_k of the sketch
+   */
+  uint8_t get_lg_k() const;
+
+  /**
+   * @return true if the sketch represents an empty set
+   */
+  bool is_empty() const;
+
+  /**
+   * @return estimate of the distinct count of the input stream
+   */
+  double get_estimate() const;
+
+  /**
+   * Returns the approximate lower error bound given a parameter kappa (1, 2 or 3).
+   * The same as cpc_sketch_alloc::get_lower_bound().
+   * @param kappa parameter to specify confidence interval (1, 2 or 3)
+   * @return the lower bound
+   */
+  double get_lower_bound(unsigned kappa) const;
+
+  /**
+   * Returns the approximate upper error bound given a parameter kappa (1, 2 or 3).
+   * The same as cpc_sketch_alloc::get_upper_bound().
+   * @param kappa parameter to specify confidence interval (1, 2 or 3)
+   * @return the upper bound
+   */
+  double get_upper_bound(unsigned kappa) const;
+
+  /**
+   * Decompresses the serialized data.
+   * @return an instance of the sketch
+   */
+  cpc_sketch_alloc<A> to_sketch() const;
+
+  // for internal use
+  uint32_t get_num_coupons() const;
+
+private:
+  using serialized_image = typename cpc_sketch_alloc<A>::serialized_image;
+
+  serialized_image image_;
+  uint64_t seed_;
+  A allocator_;
+
+  wrapped_cpc_sketch_alloc(const serialized_image& image, uint64_t seed, const A& allocator);
+
+  friend cpc_union_alloc<A>;
 };
 
 } /* namespace datasketches */
@@ -37,7 +37,7 @@ namespace datasketches {
 
 template<typename A>
 void cpc_init() {
-  get_compressor<A>(); // this initializes a global static instance of the compressor on the first use
+  get_compressor<A>(); // no initialization is needed, the decoding tables are static data
 }
 
 template<typename A>
@@ -192,6 +192,57 @@ void cpc_sketch_alloc<A>::update(const void* value, size_t size) {
   row_col_update(row_col_from_two_hashes(hashes.h1, hashes.h2, lg_k));
 }
 
+template<typename A>
+void cpc_sketch_alloc<A>::update_batch(const uint64_t* values, size_t count) {
+  uint32_t row_cols[UPDATE_BATCH_SIZE];
+  while (count > 0) {
+    const size_t n = count < UPDATE_BATCH_SIZE ? count : UPDATE_BATCH_SIZE;
+    for (size_t i = 0; i < n; ++i) {
+      HashState hashes;
+      MurmurHash3_x64_128(&values[i], sizeof(uint64_t), seed, hashes);
+      row_cols[i] = row_col_from_two_hashes(hashes.h1, hashes.h2, lg_k);
+    }
+    row_col_batch_update(row_cols, n);
+    values += n;
+    count -= n;
+  }
+}
+
+template<typename A>
+void cpc_sketch_alloc<A>::update_batch(const std::string* values, size_t count) {
+  uint32_t row_cols[UPDATE_BATCH_SIZE];
+  while (count > 0) {
+    size_t n = 0;
+    size_t consumed = 0;
+    while (consumed < count && n < UPDATE_BATCH_SIZE) {
+      const std::string& value = values[consumed++];
+      if (value.empty()) continue;
+      HashState hashes;
+      MurmurHash3_x64_128(value.c_str(), value.length(), seed, hashes);
+      row_cols[n++] = row_col_from_two_hashes(hashes.h1, hashes.h2, lg_k);
+    }
+    row_col_batch_update(row_cols, n);
+    values += consumed;
+    count -= consumed;
+  }
+}
+
+// Applies the pairs in order, so flavor transitions happen at the same points as with single updates.
+// The first interesting column never decreases, so filtering with its value at the start
+// of the batch is safe. Each pair is checked again in row_col_update().
+template<typename A>
+void cpc_sketch_alloc<A>::row_col_batch_update(uint32_t* row_cols, size_t count) {
+  size_t n = 0;
+  for (size_t i = 0; i < count; ++i) {
+    row_cols[n] = row_cols[i];
+    n += (row_cols[i] & 63) >= first_interesting_column;
+  }
+  if (sliding_window.size() == 0) {
+    for (size_t i = 0; i < n; ++i) surprising_value_table.prefetch(row_cols[i]);
+  }
+  for (size_t i = 0; i < n; ++i) row_col_update(row_cols[i]);
+}
+
 template<typename A>
 void cpc_sketch_alloc<A>::row_col_update(uint32_t row_col) {
   const uint8_t col = row_col & 63;
@@ -591,74 +642,86 @@ cpc_sketch_alloc<A> cpc_sketch_alloc<A>::deserialize(std::istream& is, uint64_t
 
 template<typename A>
 cpc_sketch_alloc<A> cpc_sketch_alloc<A>::deserialize(const void* bytes, size_t size, uint64_t seed, const A& allocator) {
+  return uncompress(parse(bytes, size, seed), seed, allocator);
+}
+
+template<typename A>
+typename cpc_sketch_alloc<A>::serialized_image cpc_sketch_alloc<A>::parse(const void* bytes, size_t size, uint64_t seed) {
+  const serialized_image image = parse_prefix(bytes, size, seed);
+  if (image.size_bytes != size) throw std::logic_error("deserialized size mismatch");
+  return image;
+}
+
+template<typename A>
+typename cpc_sketch_alloc<A>::serialized_image cpc_sketch_alloc<A>::parse_prefix(const void* bytes, size_t size, uint64_t seed) {
   ensure_minimum_memory(size, 8);
   const char* ptr = static_cast<const char*>(bytes);
   const char* base = static_cast<const char*>(bytes);
+  serialized_image image;
   uint8_t preamble_ints;
   ptr += copy_from_mem(ptr, preamble_ints);
   uint8_t serial_version;
   ptr += copy_from_mem(ptr, serial_version);
   uint8_t family_id;
   ptr += copy_from_mem(ptr, family_id);
-  uint8_t lg_k;
-  ptr += copy_from_mem(ptr, lg_k);
-  uint8_t first_interesting_column;
-  ptr += copy_from_mem(ptr, first_interesting_column);
+  ptr += copy_from_mem(ptr, image.lg_k);
+  ptr += copy_from_mem(ptr, image.first_interesting_column);
   uint8_t flags_byte;
   ptr += copy_from_mem(ptr, flags_byte);
   uint16_t seed_hash;
   ptr += copy_from_mem(ptr, seed_hash);
-  const bool has_hip = flags_byte & (1 << flags::HAS_HIP);
-  const bool has_table = flags_byte & (1 << flags::HAS_TABLE);
-  const bool has_window = flags_byte & (1 << flags::HAS_WINDOW);
+  image.has_hip = flags_byte & (1 << flags::HAS_HIP);
+  image.has_table = flags_byte & (1 << flags::HAS_TABLE);
+  image.has_window = flags_byte & (1 << flags::HAS_WINDOW);
   ensure_minimum_memory(size, preamble_ints << 2);
-  compressed_state<A> compressed(allocator);
-  compressed.table_data_words = 0;
-  compressed.table_num_entries = 0;
-  compressed.window_data_words = 0;
-  uint32_t num_coupons = 0;
-  double kxp = 0;
-  double hip_est_accum = 0;
-  if (has_table || has_window) {
-    check_memory_size(ptr - base + sizeof(num_coupons), size);
-    ptr += copy_from_mem(ptr, num_coupons);
-    if (has_table && has_window) {
-      check_memory_size(ptr - base + sizeof(compressed.table_num_entries), size);
-      ptr += copy_from_mem(ptr, compressed.table_num_entries);
-      if (has_hip) {
-        check_memory_size(ptr - base + sizeof(kxp) + sizeof(hip_est_accum), size);
-        ptr += copy_from_mem(ptr, kxp);
-        ptr += copy_from_mem(ptr, hip_est_accum);
+  image.table_data_words = 0;
+  image.table_num_entries = 0;
+  image.window_data_words = 0;
+  image.num_coupons = 0;
+  image.kxp = 0;
+  image.hip_est_accum = 0;
+  image.table_data = nullptr;
+  image.window_data = nullptr;
+  if (image.has_table || image.has_window) {
+    check_memory_size(ptr - base + sizeof(image.num_coupons), size);
+    ptr += copy_from_mem(ptr, image.num_coupons);
+    if (image.has_table && image.has_window) {
+      check_memory_size(ptr - base + sizeof(image.table_num_entries), size);
+      ptr += copy_from_mem(ptr, image.table_num_entries);
+      if (image.has_hip) {
+        check_memory_size(ptr - base + sizeof(image.kxp) + sizeof(image.hip_est_accum), size);
+        ptr += copy_from_mem(ptr, image.kxp);
+        ptr += copy_from_mem(ptr, image.hip_est_accum);
       }
     }
-    if (has_table) {
-      check_memory_size(ptr - base + sizeof(compressed.table_data_words), size);
-      ptr += copy_from_mem(ptr, compressed.table_data_words);
+    if (image.has_table) {
+      check_memory_size(ptr - base + sizeof(image.table_data_words), size);
+      ptr += copy_from_mem(ptr, image.table_data_words);
     }
-    if (has_window) {
-      check_memory_size(ptr - base + sizeof(compressed.window_data_words), size);
-      ptr += copy_from_mem(ptr, compressed.window_data_words);
+    if (image.has_window) {
+      check_memory_size(ptr - base + sizeof(image.window_data_words), size);
+      ptr += copy_from_mem(ptr, image.window_data_words);
     }
-    if (has_hip && !(has_table && has_window)) {
-      check_memory_size(ptr - base + sizeof(kxp) + sizeof(hip_est_accum), size);
-      ptr += copy_from_mem(ptr, kxp);
-      ptr += copy_from_mem(ptr, hip_est_accum);
+    if (image.has_hip && !(image.has_table && image.has_window)) {
+      check_memory_size(ptr - base + sizeof(image.kxp) + sizeof(image.hip_est_accum), size);
+      ptr += copy_from_mem(ptr, image.kxp);
+      ptr += copy_from_mem(ptr, image.hip_est_accum);
     }
-    if (has_window) {
-      compressed.window_data.resize(compressed.window_data_words);
-      check_memory_size(ptr - base + (compressed.window_data_words * sizeof(uint32_t)), size);
-      ptr += copy_from_mem(ptr, compressed.window_data.data(), compressed.window_data_words * sizeof(uint32_t));
+    if (image.has_window) {
+      check_memory_size(ptr - base + (image.window_data_words * sizeof(uint32_t)), size);
+      image.window_data = ptr;
+      ptr += image.window_data_words * sizeof(uint32_t);
     }
-    if (has_table) {
-      compressed.table_data.resize(compressed.table_data_words);
-      check_memory_size(ptr - base + (compressed.table_data_words * sizeof(uint32_t)), size);
-      ptr += copy_from_mem(ptr, compressed.table_data.data(), compressed.table_data_words * sizeof(uint32_t));
+    if (image.has_table) {
+      check_memory_size(ptr - base + (image.table_data_words * sizeof(uint32_t)), size);
+      image.table_data = ptr;
+      ptr += image.table_data_words * sizeof(uint32_t);
     }
-    if (!has_window) compressed.table_num_entries = num_coupons;
+    if (!image.has_window) image.table_num_entries = image.num_coupons;
   }
-  if (ptr != static_cast<const char*>(bytes) + size) throw std::logic_error("deserialized size mismatch");
+  image.size_bytes = ptr - base;
 
-  uint8_t expected_preamble_ints = get_preamble_ints(num_coupons, has_hip, has_table, has_window);
+  uint8_t expected_preamble_ints = get_preamble_ints(image.num_coupons, image.has_hip, image.has_table, image.has_window);
   if (preamble_ints != expected_preamble_ints) {
     throw std::invalid_argument("Possible corruption: preamble ints: expected "
         + std::to_string(expected_preamble_ints) + ", got " + std::to_string(preamble_ints));
@@ -675,10 +738,27 @@ cpc_sketch_alloc<A> cpc_sketch_alloc<A>::deserialize(const void* bytes, size_t s
     throw std::invalid_argument("Incompatible seed hashes: " + std::to_string(seed_hash) + ", "
         + std::to_string(compute_seed_hash(seed)));
   }
+  return image;
+}
+
+template<typename A>
+cpc_sketch_alloc<A> cpc_sketch_alloc<A>::uncompress(const serialized_image& image, uint64_t seed, const A& allocator) {
+  compressed_state<A> compressed(allocator);
+  compressed.table_data_words = image.table_data_words;
+  compressed.table_num_entries = image.table_num_entries;
+  compressed.window_data_words = image.window_data_words;
+  if (image.has_window) {
+    compressed.window_data.resize(image.window_data_words);
+    copy_from_mem(image.window_data, compressed.window_data.data(), image.window_data_words * sizeof(uint32_t));
+  }
+  if (image.has_table) {
+    compressed.table_data.resize(image.table_data_words);
+    copy_from_mem(image.table_data, compressed.table_data.data(), image.table_data_words * sizeof(uint32_t));
+  }
   uncompressed_state<A> uncompressed(allocator);
-  get_compressor<A>().uncompress(compressed, uncompressed, lg_k, num_coupons);
-  return cpc_sketch_alloc(lg_k, num_coupons, first_interesting_column, std::move(uncompressed.table),
-      std::move(uncompressed.window), has_hip, kxp, hip_est_accum, seed);
+  get_compressor<A>().uncompress(compressed, uncompressed, image.lg_k, image.num_coupons);
+  return cpc_sketch_alloc(image.lg_k, image.num_coupons, image.first_interesting_column, std::move(uncompressed.table),
+      std::move(uncompressed.window), image.has_hip, image.kxp, image.hip_est_accum, seed);
 }
 
 /*
@@ -846,6 +926,62 @@ size_t cpc_sketch_alloc<A>::copy_hip_to_mem(void* dst) const {
   return sizeof(kxp) + sizeof(hip_est_accum);
 }
 
+template<typename A>
+wrapped_cpc_sketch_alloc<A>::wrapped_cpc_sketch_alloc(const serialized_image& image, uint64_t seed, const A& allocator):
+image_(image),
+seed_(seed),
+allocator_(allocator)
+{}
+
+template<typename A>
+wrapped_cpc_sketch_alloc<A> wrapped_cpc_sketch_alloc<A>::wrap(const void* bytes, size_t size, uint64_t seed, const A& allocator) {
+  return wrapped_cpc_sketch_alloc(cpc_sketch_alloc<A>::parse(bytes, size, seed), seed, allocator);
+}
+
+template<typename A>
+uint8_t wrapped_cpc_sketch_alloc<A>::get_lg_k() const {
+  return image_.lg_k;
+}
+
+template<typename A>
+bool wrapped_cpc_sketch_alloc<A>::is_empty() const {
+  return image_.num_coupons == 0;
+}
+
+template<typename A>
+uint32_t wrapped_cpc_sketch_alloc<A>::get_num_coupons() const {
+  return image_.num_coupons;
+}
+
+template<typename A>
+double wrapped_cpc_sketch_alloc<A>::get_estimate() const {
+  if (image_.has_hip) return image_.hip_est_accum;
+  return compute_icon_estimate(image_.lg_k, image_.num_coupons);
+}
+
+template<typename A>
+double wrapped_cpc_sketch_alloc<A>::get_lower_bound(unsigned kappa) const {
+  if (kappa < 1 || kappa > 3) {
+    throw std::invalid_argument("kappa must be 1, 2 or 3");
+  }
+  if (image_.has_hip) return get_hip_confidence_lb(image_.lg_k, image_.num_coupons, image_.hip_est_accum, kappa);
+  return get_icon_confidence_lb(image_.lg_k, image_.num_coupons, kappa);
+}
+
+template<typename A>
+double wrapped_cpc_sketch_alloc<A>::get_upper_bound(unsigned kappa) const {
+  if (kappa < 1 || kappa > 3) {
+    throw std::invalid_argument("kappa must be 1, 2 or 3");
+  }
+  if (image_.has_hip) return get_hip_confidence_ub(image_.lg_k, image_.num_coupons, image_.hip_est_accum, kappa);
+  return get_icon_confidence_ub(image_.lg_k, image_.num_coupons, kappa);
+}
+
+template<typename A>
+cpc_sketch_alloc<A> wrapped_cpc_sketch_alloc<A>::to_sketch() const {
+  return cpc_sketch_alloc<A>::uncompress(image_, seed_, allocator_);
+}
+
 } /* namespace datasketches */
 
 #endif
@@ -66,6 +66,39 @@ public:
    */
   void update(cpc_sketch_alloc<A>&& sketch);
 
+  /**
+   * This method is to update the union with a range of sketches.
+   * The result is the same as updating the union with each sketch of the range in turn.
+   * Sketches past SPARSE mode are OR'ed into the bit matrix of the union row by row,
+   * reusing one scratch buffer per thread instead of building a bit matrix for each sketch.
+   * The rows of the union can be split into num_threads slices, each merged by its own thread.
+   * All memory is allocated by the calling thread, so the allocator does not need to be thread-safe.
+   * @param first iterator to the first sketch
+   * @param last iterator past the last sketch
+   * @param num_threads number of threads to use (the calling thread is one of them)
+   */
+  template<typename InputIt>
+  void update(InputIt first, InputIt last, unsigned num_threads = 1);
+
+  /**
+   * This method is to update the union with a serialized sketch without deserializing it.
+   * The compressed data is decoded straight into the state of the union,
+   * so no intermediate sketch with its hash table and window is built.
+   * @param sketch to update the union with
+   */
+  void update(const wrapped_cpc_sketch_alloc<A>& sketch);
+
+  /**
+   * This method is to update the union with serialized sketches stored back to back in one buffer,
+   * such as sketches serialized one after another into the same stream.
+   * The sketches are decoded as in update(const wrapped_cpc_sketch_alloc<A>&),
+   * and the decoding buffers are reused from one sketch to the next.
+   * The sketches must have been created with the seed of the union.
+   * @param bytes pointer to the array of bytes
+   * @param size the size of the array
+   */
+  void update_serialized(const void* bytes, size_t size);
+
   /**
    * This method produces a copy of the current state of the union as a sketch.
    * @return the result of the union
@@ -83,15 +116,31 @@ private:
   vector_u64<A> bit_matrix;
 
   template<typename S> void internal_update(S&& sketch); // to support both rvalue and lvalue
+  // buffers for decoding serialized sketches, reused from one sketch to the next
+  struct decoding_buffers {
+    explicit decoding_buffers(const A& allocator): compressed(allocator), pairs(allocator), window(allocator), rows(allocator) {}
+    compressed_state<A> compressed;
+    vector_u32<A> pairs;
+    vector_u8<A> window;
+    vector_u64<A> rows;
+  };
+
+  void update_from_image(const typename cpc_sketch_alloc<A>::serialized_image& image, decoding_buffers& buffers);
+  void check_seed_hash(const cpc_sketch_alloc<A>& sketch) const;
 
   cpc_sketch_alloc<A> get_result_from_accumulator() const;
   cpc_sketch_alloc<A> get_result_from_bit_matrix() const;
 
   void switch_to_bit_matrix();
   void walk_table_updating_sketch(const u32_table<A>& table);
+  void walk_pairs_updating_sketch(const uint32_t* pairs, uint32_t num_pairs);
+  void or_pairs_into_matrix(const uint32_t* pairs, uint32_t num_pairs);
+  void or_sliding_rows_into_matrix(const vector_u32<A>& pairs, const vector_u8<A>& window, uint8_t offset, uint8_t src_lg_k,
+      vector_u64<A>& rows);
   void or_table_into_matrix(const u32_table<A>& table);
   void or_window_into_matrix(const vector_u8<A>& sliding_window, uint8_t offset, uint8_t src_lg_k);
   void or_matrix_into_matrix(const vector_u64<A>& src_matrix, uint8_t src_lg_k);
+  void or_windowed_rows_into_matrix(const cpc_sketch_alloc<A>& sketch, uint32_t dst_begin, uint32_t dst_end, vector_u64<A>& scratch);
   void reduce_k(uint8_t new_lg_k);
 };
 
@@ -22,7 +22,9 @@
 
 #include "count_zeros.hpp"
 
+#include <algorithm>
 #include <stdexcept>
+#include <thread>
 
 namespace datasketches {
 
@@ -100,14 +102,151 @@ void cpc_union_alloc<A>::update(cpc_sketch_alloc<A>&& sketch) {
 }
 
 template<typename A>
-template<typename S>
-void cpc_union_alloc<A>::internal_update(S&& sketch) {
+template<typename InputIt>
+void cpc_union_alloc<A>::update(InputIt first, InputIt last, unsigned num_threads) {
+  using AllocSketchPtr = typename std::allocator_traits<A>::template rebind_alloc<const cpc_sketch_alloc<A>*>;
+  const A allocator = bit_matrix.get_allocator();
+  std::vector<const cpc_sketch_alloc<A>*, AllocSketchPtr> sparse(allocator);
+  std::vector<const cpc_sketch_alloc<A>*, AllocSketchPtr> windowed(allocator);
+  uint8_t min_lg_k = lg_k;
+  uint8_t max_lg_k = 0;
+  for (; first != last; ++first) {
+    const cpc_sketch_alloc<A>& sketch = *first;
+    check_seed_hash(sketch);
+    const auto flavor = sketch.determine_flavor();
+    if (cpc_sketch_alloc<A>::flavor::EMPTY == flavor) continue;
+    if (cpc_sketch_alloc<A>::flavor::SPARSE == flavor) {
+      sparse.push_back(&sketch);
+    } else {
+      windowed.push_back(&sketch);
+      min_lg_k = std::min(min_lg_k, sketch.get_lg_k());
+      max_lg_k = std::max(max_lg_k, sketch.get_lg_k());
+    }
+  }
+
+  // the result depends only on the set of coupons, so the order of sketches does not matter
+  if (windowed.size() > 0) {
+    if (min_lg_k < lg_k) reduce_k(min_lg_k);
+    if (accumulator != nullptr) switch_to_bit_matrix();
+
+    const uint32_t k = 1 << lg_k;
+    num_threads = std::max(1U, std::min(num_threads, k));
+    auto slice_begin = [k, num_threads](unsigned i) {
+      return static_cast<uint32_t>(static_cast<uint64_t>(k) * i / num_threads);
+    };
+    // the scratch of every slice is allocated here, so the workers never call the allocator
+    using AllocScratch = typename std::allocator_traits<A>::template rebind_alloc<vector_u64<A>>;
+    std::vector<vector_u64<A>, AllocScratch> scratches(num_threads, vector_u64<A>(allocator), allocator);
+    const size_t num_blocks = static_cast<size_t>(1) << (max_lg_k - lg_k);
+    for (unsigned i = 0; i < num_threads; ++i) scratches[i].reserve(num_blocks * (slice_begin(i + 1) - slice_begin(i)));
+    auto merge_slice = [&](unsigned i) {
+      const uint32_t dst_begin = slice_begin(i);
+      const uint32_t dst_end = slice_begin(i + 1);
+      for (const auto sketch: windowed) or_windowed_rows_into_matrix(*sketch, dst_begin, dst_end, scratches[i]);
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (unsigned i = 1; i < num_threads; ++i) threads.emplace_back(merge_slice, i);
+    merge_slice(0);
+    for (auto& thread: threads) thread.join();
+  }
+
+  for (const auto sketch: sparse) internal_update(*sketch);
+}
+
+template<typename A>
+void cpc_union_alloc<A>::update(const wrapped_cpc_sketch_alloc<A>& sketch) {
+  const uint16_t seed_hash_union = compute_seed_hash(seed);
+  const uint16_t seed_hash_sketch = compute_seed_hash(sketch.seed_);
+  if (seed_hash_union != seed_hash_sketch) {
+    throw std::invalid_argument("Incompatible seed hashes: " + std::to_string(seed_hash_union) + ", "
+        + std::to_string(seed_hash_sketch));
+  }
+  decoding_buffers buffers(bit_matrix.get_allocator());
+  update_from_image(sketch.image_, buffers);
+}
+
+template<typename A>
+void cpc_union_alloc<A>::update_serialized(const void* bytes, size_t size) {
+  decoding_buffers buffers(bit_matrix.get_allocator());
+  const char* ptr = static_cast<const char*>(bytes);
+  while (size > 0) {
+    const auto image = cpc_sketch_alloc<A>::parse_prefix(ptr, size, seed);
+    update_from_image(image, buffers);
+    ptr += image.size_bytes;
+    size -= image.size_bytes;
+  }
+}
+
+// The same cases as in internal_update(), but the source is a list of row-column pairs
+// sorted by row and a sliding window decoded from the serialized sketch.
+template<typename A>
+void cpc_union_alloc<A>::update_from_image(const typename cpc_sketch_alloc<A>::serialized_image& image, decoding_buffers& buffers) {
+  cpc_sketch_alloc<A>::check_lg_k(image.lg_k);
+  const auto src_flavor = cpc_sketch_alloc<A>::determine_flavor(image.lg_k, image.num_coupons);
+  if (cpc_sketch_alloc<A>::flavor::EMPTY == src_flavor) return;
+
+  // the compressed words are copied because the image may be not aligned
+  compressed_state<A>& compressed = buffers.compressed;
+  compressed.table_data_words = image.table_data_words;
+  compressed.table_num_entries = image.table_num_entries;
+  compressed.window_data_words = image.window_data_words;
+  compressed.table_data.resize(image.has_table ? image.table_data_words : 0);
+  if (image.has_table) copy_from_mem(image.table_data, compressed.table_data.data(), image.table_data_words * sizeof(uint32_t));
+  compressed.window_data.resize(image.has_window ? image.window_data_words : 0);
+  if (image.has_window) copy_from_mem(image.window_data, compressed.window_data.data(), image.window_data_words * sizeof(uint32_t));
+  get_compressor<A>().uncompress_pairs(compressed, buffers.pairs, buffers.window, image.lg_k, image.num_coupons);
+  const uint32_t* pairs = buffers.pairs.data();
+  const uint32_t num_pairs = static_cast<uint32_t>(buffers.pairs.size());
+
+  if (image.lg_k < lg_k) reduce_k(image.lg_k);
+  if (accumulator == nullptr && bit_matrix.size() == 0) throw std::logic_error("both accumulator and bit matrix are absent");
+
+  if (cpc_sketch_alloc<A>::flavor::SPARSE == src_flavor) {
+    if (accumulator != nullptr) { // Case A
+      walk_pairs_updating_sketch(pairs, num_pairs);
+      const auto final_dst_flavor = accumulator->determine_flavor();
+      // if the accumulator has graduated beyond sparse, switch to a bit matrix representation
+      if (final_dst_flavor != cpc_sketch_alloc<A>::flavor::EMPTY && final_dst_flavor != cpc_sketch_alloc<A>::flavor::SPARSE) {
+        switch_to_bit_matrix();
+      }
+    } else { // Case B
+      or_pairs_into_matrix(pairs, num_pairs);
+    }
+    return;
+  }
+
+  // source is past SPARSE mode, so make sure that dest is a bit matrix
+  if (accumulator != nullptr) switch_to_bit_matrix();
+
+  if (cpc_sketch_alloc<A>::flavor::HYBRID == src_flavor) { // Case C, the pairs include the window bits
+    or_pairs_into_matrix(pairs, num_pairs);
+    return;
+  }
+  if (cpc_sketch_alloc<A>::flavor::PINNED == src_flavor) { // Case C
+    or_window_into_matrix(buffers.window, 0, image.lg_k);
+    or_pairs_into_matrix(pairs, num_pairs);
+    return;
+  }
+  // Case D
+  const uint8_t offset = cpc_sketch_alloc<A>::determine_correct_offset(image.lg_k, image.num_coupons);
+  or_sliding_rows_into_matrix(buffers.pairs, buffers.window, offset, image.lg_k, buffers.rows);
+}
+
+template<typename A>
+void cpc_union_alloc<A>::check_seed_hash(const cpc_sketch_alloc<A>& sketch) const {
   const uint16_t seed_hash_union = compute_seed_hash(seed);
   const uint16_t seed_hash_sketch = compute_seed_hash(sketch.seed);
   if (seed_hash_union != seed_hash_sketch) {
     throw std::invalid_argument("Incompatible seed hashes: " + std::to_string(seed_hash_union) + ", "
         + std::to_string(seed_hash_sketch));
   }
+}
+
+template<typename A>
+template<typename S>
+void cpc_union_alloc<A>::internal_update(S&& sketch) {
+  check_seed_hash(sketch);
   const auto src_flavor = sketch.determine_flavor();
   if (cpc_sketch_alloc<A>::flavor::EMPTY == src_flavor) return;
 
@@ -166,8 +305,8 @@ void cpc_union_alloc<A>::internal_update(S&& sketch) {
   // SLIDING mode involves inverted logic, so we can't just walk the source sketch.
   // Instead, we convert it to a bitMatrix that can be OR'ed into the destination.
   if (cpc_sketch_alloc<A>::flavor::SLIDING != src_flavor) throw std::logic_error("wrong flavor"); // Case D
-  vector_u64<A> src_matrix = sketch.build_bit_matrix();
-  or_matrix_into_matrix(src_matrix, sketch.get_lg_k());
+  vector_u64<A> scratch(bit_matrix.get_allocator());
+  or_windowed_rows_into_matrix(sketch, 0, 1 << lg_k, scratch);
 }
 
 template<typename A>
@@ -216,14 +355,19 @@ cpc_sketch_alloc<A> cpc_union_alloc<A>::get_result_from_bit_matrix() const {
   const uint64_t mask_for_flipping_early_zone = (static_cast<uint64_t>(1) << offset) - 1;
   uint64_t all_surprises_ored = 0;
 
+  // The window extraction is a separate pass without branches, so that it can be vectorized.
+  for (uint32_t i = 0; i < k; i++) {
+    const uint64_t pattern = bit_matrix[i];
+    sliding_window[i] = (pattern >> offset) & 0xff;
+    all_surprises_ored |= (pattern & mask_for_clearing_window) ^ mask_for_flipping_early_zone;
+  }
+
   // The snowplow effect was caused by processing the rows in order,
   // but we have fixed it by using a sufficiently large hash table.
   for (uint32_t i = 0; i < k; i++) {
     uint64_t pattern = bit_matrix[i];
-    sliding_window[i] = (pattern >> offset) & 0xff;
     pattern &= mask_for_clearing_window;
     pattern ^= mask_for_flipping_early_zone; // this flipping converts surprising 0's to 1's
-    all_surprises_ored |= pattern;
     while (pattern != 0) {
       const uint8_t col = count_trailing_zeros_in_u64(pattern);
       pattern = pattern ^ (static_cast<uint64_t>(1) << col); // erase the 1
@@ -273,6 +417,51 @@ void cpc_union_alloc<A>::walk_table_updating_sketch(const u32_table<A>& table) {
   }
 }
 
+// The pairs are sorted by row, so they are visited with a golden ratio stride
+// to avoid the snowplow effect, as in walk_table_updating_sketch().
+template<typename A>
+void cpc_union_alloc<A>::walk_pairs_updating_sketch(const uint32_t* pairs, uint32_t num_pairs) {
+  uint32_t num_slots = 4;
+  while (num_slots < num_pairs) num_slots <<= 1;
+  const uint64_t dst_mask = (((1 << accumulator->get_lg_k()) - 1) << 6) | 63; // downsamples when dst lgK < src LgK
+
+  const double golden = 0.6180339887498949025;
+  uint32_t stride = static_cast<uint32_t>(golden * static_cast<double>(num_slots));
+  if (stride == ((stride >> 1) << 1)) stride += 1; // force the stride to be odd
+
+  for (uint32_t i = 0, j = 0; i < num_slots; i++, j += stride) {
+    j &= num_slots - 1;
+    if (j < num_pairs) accumulator->row_col_update(pairs[j] & dst_mask);
+  }
+}
+
+template<typename A>
+void cpc_union_alloc<A>::or_pairs_into_matrix(const uint32_t* pairs, uint32_t num_pairs) {
+  const uint32_t dest_mask = (1 << lg_k) - 1;  // downsamples when dst lgK < src LgK
+  for (uint32_t i = 0; i < num_pairs; i++) {
+    const uint32_t row_col = pairs[i];
+    bit_matrix[(row_col >> 6) & dest_mask] |= static_cast<uint64_t>(1) << (row_col & 63);
+  }
+}
+
+// This builds the source bit matrix the same way as cpc_sketch_alloc::build_bit_matrix(),
+// but in a buffer that can be reused, and ORs it in.
+template<typename A>
+void cpc_union_alloc<A>::or_sliding_rows_into_matrix(const vector_u32<A>& pairs, const vector_u8<A>& window,
+    uint8_t offset, uint8_t src_lg_k, vector_u64<A>& rows) {
+  const uint32_t src_k = 1 << src_lg_k;
+  if (window.size() != src_k) throw std::logic_error("window size mismatch");
+  rows.resize(src_k);
+  const uint64_t default_row = (static_cast<uint64_t>(1) << offset) - 1;
+  for (uint32_t i = 0; i < src_k; i++) rows[i] = default_row | (static_cast<uint64_t>(window[i]) << offset);
+  for (const uint32_t row_col: pairs) {
+    const uint32_t row = row_col >> 6;
+    if (row >= src_k) throw std::logic_error("row out of range");
+    rows[row] ^= static_cast<uint64_t>(1) << (row_col & 63);
+  }
+  or_matrix_into_matrix(rows, src_lg_k);
+}
+
 template<typename A>
 void cpc_union_alloc<A>::or_table_into_matrix(const u32_table<A>& table) {
   const uint32_t* slots = table.get_slots();
@@ -291,20 +480,69 @@ void cpc_union_alloc<A>::or_table_into_matrix(const u32_table<A>& table) {
 template<typename A>
 void cpc_union_alloc<A>::or_window_into_matrix(const vector_u8<A>& sliding_window, uint8_t offset, uint8_t src_lg_k) {
   if (lg_k > src_lg_k) throw std::logic_error("dst LgK > src LgK");
-  const uint64_t dst_mask = (1 << lg_k) - 1; // downsamples when dst lgK < src LgK
+  const uint32_t dst_k = 1 << lg_k;
   const uint32_t src_k = 1 << src_lg_k;
-  for (uint32_t src_row = 0; src_row < src_k; src_row++) {
-    bit_matrix[src_row & dst_mask] |= static_cast<uint64_t>(sliding_window[src_row]) << offset;
+  uint64_t* dst = bit_matrix.data();
+  // source rows are taken in blocks of dst_k, which downsamples when dst lgK < src LgK
+  for (uint32_t block = 0; block < src_k; block += dst_k) {
+    const uint8_t* src = sliding_window.data() + block;
+    for (uint32_t i = 0; i < dst_k; i++) dst[i] |= static_cast<uint64_t>(src[i]) << offset;
   }
 }
 
 template<typename A>
 void cpc_union_alloc<A>::or_matrix_into_matrix(const vector_u64<A>& src_matrix, uint8_t src_lg_k) {
   if (lg_k > src_lg_k) throw std::logic_error("dst LgK > src LgK");
-  const uint64_t dst_mask = (1 << lg_k) - 1; // downsamples when dst lgK < src LgK
+  const uint32_t dst_k = 1 << lg_k;
   const uint32_t src_k = 1 << src_lg_k;
-  for (uint32_t src_row = 0; src_row < src_k; src_row++) {
-    bit_matrix[src_row & dst_mask] |= src_matrix[src_row];
+  uint64_t* dst = bit_matrix.data();
+  // source rows are taken in blocks of dst_k, which downsamples when dst lgK < src LgK
+  for (uint32_t block = 0; block < src_k; block += dst_k) {
+    const uint64_t* src = src_matrix.data() + block;
+    for (uint32_t i = 0; i < dst_k; i++) dst[i] |= src[i];
+  }
+}
+
+// This builds the rows of the source bit matrix that map to the given rows of the destination
+// the same way as cpc_sketch_alloc::build_bit_matrix(), and ORs them in.
+// Works for all flavors past SPARSE: before SLIDING the offset is zero and the table holds only surprising 1's.
+// Threads may call this concurrently for disjoint row ranges.
+template<typename A>
+void cpc_union_alloc<A>::or_windowed_rows_into_matrix(const cpc_sketch_alloc<A>& sketch,
+    uint32_t dst_begin, uint32_t dst_end, vector_u64<A>& scratch) {
+  const uint8_t src_lg_k = sketch.get_lg_k();
+  if (lg_k > src_lg_k) throw std::logic_error("dst LgK > src LgK");
+  if (sketch.sliding_window.size() == 0) throw std::logic_error("no sliding window");
+  const uint32_t slice_size = dst_end - dst_begin;
+  const uint32_t num_blocks = 1 << (src_lg_k - lg_k); // number of source rows folded into each destination row
+  scratch.resize(static_cast<size_t>(num_blocks) * slice_size);
+
+  const uint8_t offset = sketch.window_offset;
+  const uint64_t default_row = (static_cast<uint64_t>(1) << offset) - 1;
+  for (uint32_t block = 0; block < num_blocks; block++) {
+    const uint8_t* src = sketch.sliding_window.data() + (static_cast<size_t>(block) << lg_k) + dst_begin;
+    uint64_t* rows = scratch.data() + static_cast<size_t>(block) * slice_size;
+    for (uint32_t i = 0; i < slice_size; i++) rows[i] = default_row | (static_cast<uint64_t>(src[i]) << offset);
+  }
+
+  const uint32_t dst_mask = (1 << lg_k) - 1;
+  const uint32_t* slots = sketch.surprising_value_table.get_slots();
+  const uint32_t num_slots = 1 << sketch.surprising_value_table.get_lg_size();
+  for (uint32_t i = 0; i < num_slots; i++) {
+    const uint32_t row_col = slots[i];
+    if (row_col != UINT32_MAX) {
+      const uint32_t row = row_col >> 6;
+      const uint32_t dst_row = row & dst_mask;
+      if (dst_row >= dst_begin && dst_row < dst_end) {
+        scratch[static_cast<size_t>(row >> lg_k) * slice_size + dst_row - dst_begin] ^= static_cast<uint64_t>(1) << (row_col & 63);
+      }
+    }
+  }
+
+  uint64_t* dst = bit_matrix.data() + dst_begin;
+  for (uint32_t block = 0; block < num_blocks; block++) {
+    const uint64_t* rows = scratch.data() + static_cast<size_t>(block) * slice_size;
+    for (uint32_t i = 0; i < slice_size; i++) dst[i] |= rows[i];
   }
 }
 
@@ -0,0 +1,6066 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef CPC_DECOMPRESSION_DATA_HPP_
+#define CPC_DECOMPRESSION_DATA_HPP_
+
+#include <cstdint>
+
+namespace datasketches {
+
+/*
+  These decoding tables are the exact inverses of the encoding tables in compression_data.hpp.
+  This file is generated by cpc/tools/generate_decompression_data.cpp, so do not edit it.
+  Build the target cpc_decompression_data to regenerate it.
+  The test cpc_decompression_data_check fails if it does not match the encoding tables.
+
+  Each decoding table has 4096 entries indexed by the next 12 bits of the stream.
+  An entry is (code_length << 8) | symbol.
+
+  The data are static members of a class template so that a program has one copy of them
+  regardless of the number of translation units that include this header.
+  The template parameter is not used.
+*/
+
+template<typename T>
+struct cpc_decoding_data {
+  static const uint16_t decoding_tables_for_high_entropy_byte[22][4096];
+  static const uint16_t length_limited_unary_decoding_table65[4096];
+  static const uint8_t column_permutations_for_decoding[16][56];
+};
+
+using decompression_data = cpc_decoding_data<void>;
+
+template<typename T>
+const uint16_t cpc_decoding_data<T>::decoding_tables_for_high_entropy_byte[22][4096] = {
+ // table 0 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a08, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1a, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a08, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1a, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a08, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1a, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a08, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0900, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a1a, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x080a, 0x0207, 0x061b, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x061b, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x0517, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x0517, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x061b, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x0517, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072f, 0x0207, 0x0517, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x061b, 0x030f, 0x0cff
+ },
+ // table 1 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b08,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c10,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b08,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a26, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0904, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098f, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0916, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a0c, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0706, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x0743, 0x0207, 0x0609, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084f, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x081d, 0x0207, 0x060d, 0x030f, 0x0cff
+ },
+ // table 2 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a16, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b08,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a04, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a16, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c10,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a04, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a16, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b08,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a04, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c46,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a12, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a00, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a1e, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0941, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x090a, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x098b, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0953, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x092d, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a16, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x081d, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0887, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0837, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c14,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0945, 0x0207, 0x0505, 0x0303, 0x0802, 0x0207, 0x060d, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0825, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x0929, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x084b, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a04, 0x0207, 0x0505, 0x0303, 0x080e, 0x0207, 0x060d, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0821, 0x0207, 0x0501, 0x0303, 0x0711, 0x0207, 0x051f, 0x030f, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x088f, 0x0207, 0x0505, 0x0303, 0x0747, 0x0207, 0x0609, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x083f, 0x0207, 0x0501, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0957, 0x0207, 0x0505, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0513, 0x030f, 0x0833, 0x0207, 0x0501, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0517, 0x030f, 0x093b, 0x0207, 0x0505, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0883, 0x0207, 0x0501, 0x0303, 0x0743, 0x0207, 0x051f, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0517, 0x030f, 0x0a31, 0x0207, 0x0505, 0x0303, 0x0819, 0x0207, 0x060d, 0x030f, 0x0cff
+ },
+ // table 3 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a04, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b00,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c89,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c08,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a04, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a04, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b00,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a04, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0929, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098f, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0837, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x0609, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x090a, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0957, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x0609, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x060d, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x062f, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x0609, 0x030f, 0x0cff
+ },
+ // table 4 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a29, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b00,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c08,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a35, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c22,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a29, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b04,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c14,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b77,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a35, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b0c,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c51,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a29, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b00,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c10,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a35, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c46,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c89,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a29, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b04,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b77,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a35, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cff
+ },
+ // table 5 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a29,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c00,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b04,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c14,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c39,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a29,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c0c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b77,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c1a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a29,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0b9b,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c22,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c08,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b04,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c51,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b6b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b1e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a29,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c46,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c89,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a41,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c10,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b12,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a6f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b77,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a0a, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0baf,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x093b, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0a9f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0902, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0967, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0953, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0921, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0997, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0819, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x0887, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x083f, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0945, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0825, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x090e, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0857, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x098b, 0x0207, 0x0417, 0x0303, 0x0806, 0x0207, 0x060d, 0x030f, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x081d, 0x0207, 0x0417, 0x0303, 0x0709, 0x0207, 0x051f, 0x030f, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x088f, 0x0207, 0x0417, 0x0303, 0x0743, 0x0207, 0x0601, 0x030f, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x084b, 0x0207, 0x0417, 0x0303, 0x072b, 0x0207, 0x051f, 0x030f, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x095f, 0x0207, 0x0417, 0x0303, 0x074f, 0x0207, 0x060d, 0x030f, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061b, 0x0207, 0x0505, 0x030f, 0x0833, 0x0207, 0x0417, 0x0303, 0x0715, 0x0207, 0x051f, 0x030f, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x030f, 0x092d, 0x0207, 0x0417, 0x0303, 0x0747, 0x0207, 0x0601, 0x030f, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x0505, 0x030f, 0x0883, 0x0207, 0x0417, 0x0303, 0x0737, 0x0207, 0x051f, 0x030f, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x062f, 0x0207, 0x0513, 0x030f, 0x0a16, 0x0207, 0x0417, 0x0303, 0x0811, 0x0207, 0x060d, 0x030f, 0x0cff
+ },
+ // table 6 of 22
+ {
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a26,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c77,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b57,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc0,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c55,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce0,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c8e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c34,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd0,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b2e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c67,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf0,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7f,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b8f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc8,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b18,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce8,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c98,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c44,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd8,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1e, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf8,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7b,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc4,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce4,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c94,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c3a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd4,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b3b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf4,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c88,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c28,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0ccc,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b24,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cac,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c62,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0cec,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c4e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cdc,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cbc,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c73,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cfc,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a26,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c79,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b63,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc2,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c58,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce2,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c91,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c38,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd2,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c69,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf2,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c84,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b93,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cca,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b1c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0caa,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c60,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0cea,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c4a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cda,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cba,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c71,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1e, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cfa,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc6,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5c,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce6,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c96,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c3d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd6,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b3f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf6,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c8c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c30,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cce,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cae,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c65,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0cee,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c52,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cde,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cbe,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c75,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cfe,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a26,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c78,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b57,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc1,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c56,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce1,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c90,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c36,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd1,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b2e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c68,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf1,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c80,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b8f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc9,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b18,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce9,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c99,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c48,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd9,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c70,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1e, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf9,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc5,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce5,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c95,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c3c,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd5,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b3b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6c,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf5,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c8a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c2c,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0ccd,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b24,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cad,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c64,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ced,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c50,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cdd,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cbd,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c74,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cfd,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a26,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b63,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc3,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c59,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce3,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c92,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c39,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd3,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf3,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c86,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b93,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0ccb,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b1c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cab,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c61,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ceb,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9b,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c4c,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cdb,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cbb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c72,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1e, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cfb,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c7e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cc7,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0ca7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c5d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0981, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0ce7,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c97,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c3e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cd7,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b3f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cb7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c6e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cf7,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0883, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c8d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c32,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0ccf,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0caf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c66,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0808, 0x0203, 0x0602, 0x0307, 0x0cef,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0600, 0x0307, 0x0c9f,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c54,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0602, 0x0307, 0x0cdf,
+  0x0203, 0x0405, 0x0301, 0x0606, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0723, 0x0203, 0x0600, 0x0307, 0x0cbf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0513, 0x0307, 0x0c76,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x080e, 0x0203, 0x0602, 0x0307, 0x0cff
+ },
+ // table 7 of 22
+ {
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c77,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b63,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca0,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c55,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c8e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c34,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb0,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c67,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b93,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b18,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca8,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5e,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c98,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c44,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb8,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6f,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca4,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5a,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c94,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c3a,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b3f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb4,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6b,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c88,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c2c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0ccc,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b24,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cac,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c62,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cec,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a81,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c4e,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cdc,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cbc,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c73,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a26, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cfc,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c79,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca2,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c58,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c91,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c38,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b3b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb2,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c69,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c84,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c1c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cca,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b1e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0caa,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c60,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cea,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c4a,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cda,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cba,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c71,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cfa,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b8f,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca6,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c96,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c3d,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b40,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb6,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6d,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c8c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c30,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cce,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cae,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c65,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cee,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a81,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c52,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cde,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b57,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cbe,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c75,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a26, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cfe,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c78,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b63,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca1,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c56,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c90,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c36,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb1,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c68,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c80,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b93,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b18,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca9,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5f,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c99,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c48,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb9,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c70,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca5,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5b,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c95,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c3c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b3f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb5,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c8a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c2e,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0ccd,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b24,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cad,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c64,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ced,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a81,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c50,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cdd,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cbd,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c74,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a26, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cfd,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca3,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c59,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c92,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c39,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b3b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb3,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6a,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a14, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a37,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c86,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c28,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0ccb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b1e,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cab,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c61,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ceb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a53,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c4c,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cdb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cbb,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c72,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a20, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cfb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c7e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0b8f,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x092f, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cc7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0a8b,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0916, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0ca7,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c5d,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0983, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0ce7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a4f,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x090c, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c97,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c3e,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0945, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cd7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b40,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0922, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cb7,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c6e,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a1a, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cf7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0808, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0847, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c8d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x081f, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c32,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0933, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0ccf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0812, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x091d, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0caf,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x082b, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c66,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0987, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cef,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x080e, 0x0203, 0x040b, 0x0301, 0x0700, 0x0203, 0x0513, 0x0307, 0x0a81,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0910, 0x0203, 0x040b, 0x0301, 0x071b, 0x0203, 0x0602, 0x0307, 0x0c9f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0825, 0x0203, 0x040b, 0x0301, 0x070a, 0x0203, 0x0513, 0x0307, 0x0c54,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x094b, 0x0203, 0x040b, 0x0301, 0x0727, 0x0203, 0x0606, 0x0307, 0x0cdf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0509, 0x0307, 0x0819, 0x0203, 0x040b, 0x0301, 0x0704, 0x0203, 0x0513, 0x0307, 0x0b57,
+  0x0203, 0x0405, 0x0301, 0x0617, 0x0203, 0x050f, 0x0307, 0x0929, 0x0203, 0x040b, 0x0301, 0x0721, 0x0203, 0x0602, 0x0307, 0x0cbf,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0841, 0x0203, 0x040b, 0x0301, 0x0715, 0x0203, 0x0513, 0x0307, 0x0c76,
+  0x0203, 0x0405, 0x0301, 0x0623, 0x0203, 0x050f, 0x0307, 0x0a26, 0x0203, 0x040b, 0x0301, 0x0743, 0x0203, 0x0606, 0x0307, 0x0cff
+ },
+ // table 8 of 22
+ {
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c76,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca0,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c50,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8c,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c30,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb0,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c65,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7e,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca8,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5c,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c98,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c3d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb8,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6e,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7a,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca4,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c58,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c92,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c38,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb4,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6a,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c84,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cac,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c60,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0cec,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9c,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c48,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbc,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c72,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c78,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca2,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c54,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c90,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c34,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb2,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c68,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c80,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cca,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0caa,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5e,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0cea,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9a,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c40,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cda,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cba,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c70,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfa,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7c,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca6,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5a,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c95,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c3a,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb6,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6c,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c88,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c28,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cce,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b1c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cae,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c62,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0cee,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9e,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c4c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cde,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbe,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c74,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfe,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c77,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca1,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c52,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8e,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c32,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb1,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c66,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7f,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca9,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5d,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c99,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c3e,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb9,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6f,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7b,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca5,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c59,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c94,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c39,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb5,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6b,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c86,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cad,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c61,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ced,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9d,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c4a,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbd,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c73,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c79,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca3,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c56,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c91,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c36,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb3,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c69,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c82,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cab,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5f,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ceb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9b,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c44,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbb,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c71,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7d,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca7,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c5b,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0ce7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c96,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c3c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb7,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c6d,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0812, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8a,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c2c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b1c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0caf,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c64,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0987, 0x0203, 0x040f, 0x0307, 0x0808, 0x0203, 0x0606, 0x0405, 0x0cef,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0513, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9f,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0513, 0x0405, 0x0c4e,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x050d, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0513, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x050d, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbf,
+  0x0203, 0x040b, 0x0307, 0x0617, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0513, 0x0405, 0x0c75,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x050d, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cff
+ },
+ // table 9 of 22
+ {
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c76,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c4e,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c2c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c65,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5c,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c98,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c3c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6e,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c56,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c92,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c36,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6a,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c84,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cac,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c60,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cec,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c44,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c72,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cfc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c78,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c52,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c90,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c32,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c68,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c80,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cca,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0caa,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5e,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cea,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c3e,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cda,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cba,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c70,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cfa,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c59,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c95,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c39,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6c,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c88,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c1c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cce,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cae,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c62,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cee,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c4a,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cde,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbe,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c74,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cfe,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c77,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c50,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c30,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c66,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5d,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c99,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c3d,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6f,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c58,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c94,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c38,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6b,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c86,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cad,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c61,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ced,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c48,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c73,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cfd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a26,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c79,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c54,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c91,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c34,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c69,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c82,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cab,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5f,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ceb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c40,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c71,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cfb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c7d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cc7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0ca7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5a,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0ce7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c96,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c3a,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cd7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cb7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6d,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cf7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c8a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c28,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0ccf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0922, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0caf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0847, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c64,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cef,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0721, 0x0203, 0x0602, 0x0405, 0x0c9f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0841, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c4c,
+  0x0203, 0x040b, 0x0307, 0x0700, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0606, 0x0405, 0x0cdf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0727, 0x0203, 0x0602, 0x0405, 0x0cbf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c75,
+  0x0203, 0x040b, 0x0307, 0x0704, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0812, 0x0203, 0x0606, 0x0405, 0x0cff
+ },
+ // table 10 of 22
+ {
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c76,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c4c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c8c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c1c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c65,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c5a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c98,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c54,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c92,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c32,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c84,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0ccc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cac,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c60,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cec,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c40,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cdc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c72,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c78,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c50,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c90,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c2c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c68,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c80,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cca,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0caa,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c5d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cea,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cda,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cba,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c70,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfa,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c58,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c95,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c36,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c88,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cce,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cae,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c62,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cee,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c48,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cde,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbe,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c74,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfe,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c77,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c4e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c8e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c28,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c66,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c5c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c99,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c56,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c94,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c34,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6b,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c86,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0ccd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cad,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c61,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ced,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c44,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cdd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c73,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c79,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c52,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c91,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c30,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c69,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c82,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0ccb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cab,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c5e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ceb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cdb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c71,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c7d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cc7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c59,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0981, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0ce7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c96,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c38,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cd7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c6d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c8a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0ccf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0caf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c64,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cef,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0700, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0602, 0x0405, 0x0c9f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c4a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0606, 0x0405, 0x0cdf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x070a, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071b, 0x0203, 0x0517, 0x0405, 0x0c75,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cff
+ },
+ // table 11 of 22
+ {
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c76,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c4c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c8c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c1c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb0,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c65,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf0,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c98,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb8,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf8,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c54,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c92,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c32,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb4,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf4,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c84,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0ccc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cac,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c60,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0cec,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c40,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cdc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cbc,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c72,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfc,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c78,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c50,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c90,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c2c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb2,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c68,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf2,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c80,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cca,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0caa,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0cea,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cda,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cba,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c70,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfa,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7c,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c58,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c95,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c36,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb6,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf6,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c88,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cce,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cae,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c62,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0cee,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c48,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cde,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cbe,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c74,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfe,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c77,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c4e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c8e,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c28,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b24,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb1,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c66,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf1,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c99,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3c,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb9,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf9,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c56,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c94,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c34,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb5,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf5,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c86,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0ccd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b18,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cad,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c61,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ced,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c44,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cdd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cbd,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c73,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfd,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a31,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c79,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c52,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c91,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c30,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb3,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c69,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf3,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c82,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0ccb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cab,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c5e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ceb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9b,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cdb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cbb,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c71,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cfb,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c7d,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0cc7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0ca7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c59,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x098b, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0ce7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c96,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c38,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094b, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cd7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cb7,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c6d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cf7,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c8a,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082b, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x0606, 0x0405, 0x0ccf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b20,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0caf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c64,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a14, 0x0203, 0x040f, 0x0307, 0x080a, 0x0203, 0x0606, 0x0405, 0x0cef,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0c9f,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x082f, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c4a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x0606, 0x0405, 0x0cdf,
+  0x0203, 0x040b, 0x0307, 0x060d, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0627, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x0602, 0x0405, 0x0cbf,
+  0x0203, 0x040b, 0x0307, 0x0611, 0x0203, 0x0509, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x071f, 0x0203, 0x0517, 0x0405, 0x0c75,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x080e, 0x0203, 0x0606, 0x0405, 0x0cff
+ },
+ // table 12 of 22
+ {
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c76,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc0,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca0,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c4c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce0,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c8c,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c20,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd0,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb0,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c65,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf0,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7e,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc8,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca8,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c5a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce8,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c98,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c38,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd8,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb8,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf8,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7a,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc4,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca4,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c54,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce4,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c92,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c30,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd4,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b3d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb4,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf4,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c84,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0ccc,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b14,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cac,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c60,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0cec,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9c,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c40,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cdc,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbc,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c72,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a31, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cfc,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c78,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc2,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca2,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c50,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce2,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c90,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c28,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd2,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb2,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c68,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf2,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c80,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cca,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0caa,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c5d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0cea,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9a,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cda,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cba,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c70,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cfa,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7c,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc6,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca6,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c58,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce6,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c95,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c34,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd6,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb6,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf6,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c88,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c18,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cce,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cae,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c62,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0cee,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9e,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c48,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cde,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbe,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c74,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a31, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cfe,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c77,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b5f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc1,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca1,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c4e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce1,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c8e,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c24,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd1,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b2e,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb1,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c66,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf1,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7f,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b8d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc9,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca9,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c5c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce9,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c99,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd9,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b46,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb9,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6f,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf9,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7b,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b67,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc5,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca5,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c56,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce5,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c94,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c32,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd5,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b3d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb5,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6b,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf5,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c86,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b97,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0ccd,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b14,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cad,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c61,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ced,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9d,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c44,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cdd,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b55,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbd,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c73,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a31, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cfd,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a35,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c79,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b63,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc3,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a85,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca3,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c52,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce3,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a4d,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c91,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c2c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd3,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b39,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb3,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c69,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1e, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf3,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c82,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b93,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0ccb,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8f,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cab,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c5e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a10, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ceb,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a57,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9b,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c3e,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cdb,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b51,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbb,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c71,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a26, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cfb,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a3b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c7d,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0b89,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0933, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cc7,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0a8b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0912, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0ca7,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c59,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x094f, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0ce7,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a53,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0908, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c96,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c36,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0941, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cd7,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b42,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0929, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cb7,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c6d,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a22, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cf7,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080a, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a49,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0887, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c8a,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0821, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c1c,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0937, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0ccf,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x0819, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b2a,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x0916, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0caf,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x084b, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c64,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a1a, 0x0203, 0x040f, 0x0307, 0x0800, 0x0203, 0x060d, 0x0405, 0x0cef,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x080e, 0x0203, 0x040f, 0x0307, 0x0706, 0x0203, 0x0517, 0x0405, 0x0a81,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x090c, 0x0203, 0x040f, 0x0307, 0x072f, 0x0203, 0x0602, 0x0405, 0x0c9f,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0825, 0x0203, 0x040f, 0x0307, 0x0715, 0x0203, 0x0517, 0x0405, 0x0c4a,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0945, 0x0203, 0x040f, 0x0307, 0x0747, 0x0203, 0x060d, 0x0405, 0x0cdf,
+  0x0203, 0x040b, 0x0307, 0x061b, 0x0203, 0x0509, 0x0401, 0x081d, 0x0203, 0x040f, 0x0307, 0x0711, 0x0203, 0x0517, 0x0405, 0x0b5b,
+  0x0203, 0x040b, 0x0307, 0x0623, 0x0203, 0x0513, 0x0401, 0x092d, 0x0203, 0x040f, 0x0307, 0x0743, 0x0203, 0x0602, 0x0405, 0x0cbf,
+  0x0203, 0x040b, 0x0307, 0x061f, 0x0203, 0x0509, 0x0401, 0x0883, 0x0203, 0x040f, 0x0307, 0x072b, 0x0203, 0x0517, 0x0405, 0x0c75,
+  0x0203, 0x040b, 0x0307, 0x0627, 0x0203, 0x0513, 0x0401, 0x0a31, 0x0203, 0x040f, 0x0307, 0x0804, 0x0203, 0x060d, 0x0405, 0x0cff
+ },
+ // table 13 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b42,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b63,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b93,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b67,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b42,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6f,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b63,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6b,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b93,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a26,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b67,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0819, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x0800, 0x0207, 0x061b, 0x0405, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x081d, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x0804, 0x0207, 0x061b, 0x0405, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cff
+ },
+ // table 14 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a22, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b42,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a22, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6b,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a22, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b5b,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b42,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1a, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a3b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a22, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cff
+ },
+ // table 15 of 22
+ {
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c73,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0c9d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c42,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c86,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c18,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c60,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf0,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c54,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c94,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c32,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb8,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf8,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c77,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c28,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c65,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf4,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7f,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cac,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cec,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c99,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbc,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfc,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c75,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca0,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c48,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c20,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb2,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c62,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf2,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7d,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cca,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caa,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c58,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cea,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c96,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c36,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cda,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cba,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfa,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c79,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c50,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c91,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c2c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c68,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf6,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c82,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cce,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cae,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cee,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9b,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3e,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cde,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbe,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c71,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfe,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c74,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b51,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0c9e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c44,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c88,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c1c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b10,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c61,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf1,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b8d,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c56,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c95,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c34,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b2e,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb9,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6b,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf9,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c78,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b6f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca4,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c90,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c2a,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b1a,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb5,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c66,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf5,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c80,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba3,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cad,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5c,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ced,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c3c,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b3d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbd,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c70,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfd,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a31,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c76,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b55,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a81,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca1,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c4a,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5b,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c8c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c24,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b14,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb3,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c64,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a08, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf3,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a49,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7e,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b9f,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a93,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cab,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c59,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ceb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a63,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c98,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c38,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b39,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbb,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c6d,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a1e, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cfb,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a35,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0900, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c7a,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0b89,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0941, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0cc7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a85,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0929, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0ca6,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c52,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098b, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0ce7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a5f,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0912, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c92,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c30,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0953, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cd7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b22,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093b, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cb7,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c69,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a0c, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cf7,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0821, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a4d,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0904, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c84,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084b, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0ba7,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0945, 0x0207, 0x040f, 0x0303, 0x080a, 0x0207, 0x061b, 0x0405, 0x0ccf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0833, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0a97,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x092d, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0caf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0883, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c5e,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x098f, 0x0207, 0x040f, 0x0303, 0x0819, 0x0207, 0x061b, 0x0405, 0x0cef,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0825, 0x0207, 0x040f, 0x0303, 0x0711, 0x0207, 0x0517, 0x0405, 0x0a67,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x0916, 0x0207, 0x040f, 0x0303, 0x0743, 0x0207, 0x0609, 0x0405, 0x0c9c,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x084f, 0x0207, 0x040f, 0x0303, 0x072b, 0x0207, 0x0517, 0x0405, 0x0c40,
+  0x0207, 0x040b, 0x0303, 0x0702, 0x0207, 0x0513, 0x0401, 0x0957, 0x0207, 0x040f, 0x0303, 0x080e, 0x0207, 0x061b, 0x0405, 0x0cdf,
+  0x0207, 0x040b, 0x0303, 0x061f, 0x0207, 0x050d, 0x0401, 0x0837, 0x0207, 0x040f, 0x0303, 0x0715, 0x0207, 0x0517, 0x0405, 0x0b46,
+  0x0207, 0x040b, 0x0303, 0x0627, 0x0207, 0x0513, 0x0401, 0x093f, 0x0207, 0x040f, 0x0303, 0x0747, 0x0207, 0x0609, 0x0405, 0x0cbf,
+  0x0207, 0x040b, 0x0303, 0x0623, 0x0207, 0x050d, 0x0401, 0x0887, 0x0207, 0x040f, 0x0303, 0x072f, 0x0207, 0x0517, 0x0405, 0x0c72,
+  0x0207, 0x040b, 0x0303, 0x0706, 0x0207, 0x0513, 0x0401, 0x0a26, 0x0207, 0x040f, 0x0303, 0x081d, 0x0207, 0x061b, 0x0405, 0x0cff
+ },
+ // table 16 of 22
+ {
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a12,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c7e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c19,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b0d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c90,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf0,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a41,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c88,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c46,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c24,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c66,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b81,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c98,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c56,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c34,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c76,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0b, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf8,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a21,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c84,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c42,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c62,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b14,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c94,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c52,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c30,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c72,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf4,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a80,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ccc,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c28,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cac,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cec,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c15,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cdc,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c38,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cbc,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c7a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0c, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cfc,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a12,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c82,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c60,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b13,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c92,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c50,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c70,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf2,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a41,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c48,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cca,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c26,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0caa,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c68,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cea,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c0e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c58,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cda,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c36,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cba,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c78,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0b, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cfa,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a21,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c86,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c44,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c64,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b22,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c96,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c54,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c32,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c74,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf6,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a80,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cce,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cae,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cee,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c17,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cde,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cbe,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c7c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0c, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cfe,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a12,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c7f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1a,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b0d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c91,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf1,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a41,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c89,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c47,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c25,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c67,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b81,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c99,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c57,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c35,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c77,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0b, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf9,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a21,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c85,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c43,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1e,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c63,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b14,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c95,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c53,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c31,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c73,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf5,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a80,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ccd,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c29,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cad,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ced,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c16,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cdd,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c39,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cbd,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c7b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0c, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cfd,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a12,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c83,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c1c,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c61,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b13,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c93,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c51,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c71,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf3,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a41,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c49,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ccb,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c27,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cab,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c69,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ceb,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c0f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c59,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cdb,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c37,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cbb,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c79,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0b, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cfb,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a21,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c87,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c45,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cc7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c23,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ca7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c65,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0907, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ce7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0b22,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c97,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c55,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cd7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c33,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cb7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c75,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0940, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cf7,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0a80,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c8f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c4d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0811, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0ccf,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c2b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0806, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0caf,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c6d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x090a, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cef,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c18,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0710, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0c9f,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c5d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0820, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cdf,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0605, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c3b,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0809, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cbf,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0608, 0x0100, 0x0201, 0x0100, 0x0503, 0x0100, 0x0201, 0x0100, 0x0c7d,
+  0x0100, 0x0201, 0x0100, 0x0402, 0x0100, 0x0201, 0x0100, 0x0a0c, 0x0100, 0x0201, 0x0100, 0x0504, 0x0100, 0x0201, 0x0100, 0x0cff
+ },
+ // table 17 of 22
+ {
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a15,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c7c,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c37,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b28,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a42,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c90,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c26,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf0,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a23,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c88,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b83,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c64,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b16,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c98,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c54,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c74,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0e, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf8,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a18,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c84,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b44,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c60,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a81,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c94,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c50,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c70,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf4,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a24,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8c,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c48,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ccc,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cac,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c68,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cec,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b19,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9c,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c58,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cdc,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c33,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cbc,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c78,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0f, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cfc,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a15,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c7e,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c39,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b43,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a42,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c92,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c29,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf2,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a23,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8a,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c46,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cca,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0caa,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c66,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cea,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b17,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9a,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c56,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cda,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c31,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cba,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c76,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0e, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cfa,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a18,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c86,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b82,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c62,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a81,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c96,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c52,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c72,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf6,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a24,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8e,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cce,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cae,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cee,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b25,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9e,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cde,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c35,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cbe,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c7a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0f, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cfe,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a15,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c7d,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c38,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b28,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a42,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c91,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c27,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf1,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a23,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c89,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c45,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b83,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c65,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b16,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c99,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c55,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c30,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c75,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0e, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf9,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a18,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c85,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b44,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c61,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a81,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c95,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c51,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2c,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c71,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf5,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a24,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8d,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c49,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ccd,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1d,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cad,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c69,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ced,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b19,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9d,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c59,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cdd,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c34,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cbd,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c79,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0f, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cfd,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a15,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c7f,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b43,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a42,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c93,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2a,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf3,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a23,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8b,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c47,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ccb,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cab,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c67,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ceb,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b17,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9b,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c57,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cdb,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c32,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cbb,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c77,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0e, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cfb,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a18,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c87,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c3e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cc7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b82,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0ca7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c63,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0922, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ce7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a81,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c97,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c53,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x090d, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cd7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c2e,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cb7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c73,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0980, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cf7,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0a24,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x080c, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c8f,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c4b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0840, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0ccf,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c1f,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0813, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0caf,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c6b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0941, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cef,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070a, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0b25,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0812, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0c9f,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0711, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c5b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0914, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cdf,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x070b, 0x0200, 0x0302, 0x0201, 0x0606, 0x0200, 0x0404, 0x0201, 0x0c36,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0821, 0x0200, 0x0302, 0x0201, 0x0609, 0x0200, 0x0404, 0x0201, 0x0cbf,
+  0x0200, 0x0302, 0x0201, 0x0505, 0x0200, 0x0403, 0x0201, 0x0720, 0x0200, 0x0302, 0x0201, 0x0607, 0x0200, 0x0404, 0x0201, 0x0c7b,
+  0x0200, 0x0302, 0x0201, 0x0508, 0x0200, 0x0403, 0x0201, 0x0a0f, 0x0200, 0x0302, 0x0201, 0x0610, 0x0200, 0x0404, 0x0201, 0x0cff
+ },
+ // table 18 of 22
+ {
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a18,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c7c,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c36,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b26,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a42,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c90,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c1c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf0,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a24,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c88,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b44,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c64,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a80,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c98,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c54,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c74,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a16, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf8,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a19,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c84,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b28,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c60,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a43,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c94,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c50,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c70,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf4,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a25,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8c,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c48,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0ccc,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b82,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cac,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c68,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cec,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b1a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9c,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c58,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cdc,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c32,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cbc,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c78,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a17, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cfc,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a18,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c7e,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c38,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b27,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a42,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c92,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c1e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6e,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf2,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a24,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8a,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c46,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cca,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b45,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0caa,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c66,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cea,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a80,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9a,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c56,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cda,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c30,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cba,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c76,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a16, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cfa,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a19,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c86,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b29,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c62,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a43,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c96,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c52,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2c,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c72,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf6,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a25,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8e,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cce,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b83,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cae,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cee,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b1b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9e,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cde,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c34,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cbe,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c7a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a17, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cfe,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a18,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c7d,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c37,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b26,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a42,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c91,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c1d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf1,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a24,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c89,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b44,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c65,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a80,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c99,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c55,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c75,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a16, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf9,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a19,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c85,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b28,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c61,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a43,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c95,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c51,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c71,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf5,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a25,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8d,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c49,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0ccd,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b82,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cad,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c69,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ced,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b1a,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9d,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c59,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cdd,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c33,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cbd,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c79,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a17, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cfd,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a18,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c7f,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c39,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b27,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a42,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c93,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c1f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6f,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf3,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a24,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8b,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c47,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0ccb,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b45,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cab,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c67,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ceb,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a80,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9b,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c57,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cdb,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c31,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cbb,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c77,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a16, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cfb,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a19,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c87,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c3d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0914, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cc7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b29,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0ca7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c63,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0940, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0ce7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a43,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c97,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c53,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0922, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cd7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c2d,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090e, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cb7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c73,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0981, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cf7,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0a25,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0812, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c8f,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c4b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0915, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0ccf,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b83,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0820, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0caf,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080c, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c6b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0941, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cef,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0710, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0b1b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0813, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0c9f,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0721, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c5b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0923, 0x0200, 0x0303, 0x0201, 0x070a, 0x0200, 0x0405, 0x0201, 0x0cdf,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x0711, 0x0200, 0x0303, 0x0201, 0x0606, 0x0200, 0x0405, 0x0201, 0x0c35,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x090f, 0x0200, 0x0303, 0x0201, 0x0608, 0x0200, 0x0405, 0x0201, 0x0cbf,
+  0x0200, 0x0303, 0x0201, 0x0504, 0x0200, 0x0402, 0x0201, 0x080d, 0x0200, 0x0303, 0x0201, 0x0607, 0x0200, 0x0405, 0x0201, 0x0c7b,
+  0x0200, 0x0303, 0x0201, 0x0509, 0x0200, 0x0402, 0x0201, 0x0a17, 0x0200, 0x0303, 0x0201, 0x070b, 0x0200, 0x0405, 0x0201, 0x0cff
+ },
+ // table 19 of 22
+ {
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a1b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7a,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c30,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b1d,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5a,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a42,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c90,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4a,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b47,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6a,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf0,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a26,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c88,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c39,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b2b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c62,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a80,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c98,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c52,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b87,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c72,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a18, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf8,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a24,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7e,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c35,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b28,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5e,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a45,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c94,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4e,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b82,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6e,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf4,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a29,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8c,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3d,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0ccc,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b44,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cac,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c66,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cec,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a83,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9c,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c56,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cdc,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c2c,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cbc,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c76,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a1a, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cfc,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a1b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7c,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c33,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b1f,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5c,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a42,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c92,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4c,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b49,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6c,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf2,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a26,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8a,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3b,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cca,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b31,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0caa,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c64,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cea,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a80,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9a,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c54,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cda,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c1c,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cba,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c74,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a18, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cfa,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a24,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c84,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c37,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b2a,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c60,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a45,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c96,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c50,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b85,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c70,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf6,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a29,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8e,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3f,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cce,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b46,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cae,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c68,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cee,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a83,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9e,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c58,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cde,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c2e,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cbe,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c78,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a1a, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cfe,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a1b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7b,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c32,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b1d,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5b,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a42,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c91,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4b,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b47,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6b,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf1,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a26,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c89,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3a,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b2b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c63,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a80,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c99,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c53,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b87,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c73,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a18, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf9,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a24,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7f,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c36,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b28,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5f,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a45,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c95,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4f,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b82,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6f,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf5,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a29,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8d,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3e,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0ccd,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b44,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cad,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c67,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ced,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a83,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9d,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c57,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cdd,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c2d,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cbd,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c77,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a1a, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cfd,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a1b,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c7d,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c34,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b1f,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c5d,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a42,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c93,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c4d,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b49,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c6d,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf3,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a26,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8b,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c3c,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0ccb,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b31,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cab,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c65,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ceb,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a80,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9b,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c55,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cdb,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c1e,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cbb,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c75,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a18, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cfb,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a24,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c86,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c38,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0919, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cc7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b2a,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0ca7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c61,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0940, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0ce7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a45,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c97,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c51,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0925, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cd7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b85,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0914, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cb7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c71,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0981, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cf7,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a29,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0820, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c8f,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080c, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c48,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0922, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0ccf,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0b46,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0841, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0caf,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0815, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c69,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0943, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cef,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0713, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0a83,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0823, 0x0201, 0x0405, 0x0300, 0x070d, 0x0201, 0x0506, 0x0303, 0x0c9f,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x080e, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c59,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0927, 0x0201, 0x0405, 0x0300, 0x0710, 0x0201, 0x0506, 0x0303, 0x0cdf,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x0405, 0x0300, 0x060b, 0x0201, 0x0504, 0x0303, 0x0c2f,
+  0x0201, 0x0402, 0x0300, 0x0608, 0x0201, 0x0407, 0x0303, 0x0916, 0x0201, 0x0405, 0x0300, 0x070f, 0x0201, 0x0506, 0x0303, 0x0cbf,
+  0x0201, 0x0402, 0x0300, 0x0509, 0x0201, 0x0407, 0x0303, 0x0817, 0x0201, 0x0405, 0x0300, 0x0611, 0x0201, 0x0504, 0x0303, 0x0c79,
+  0x0201, 0x0402, 0x0300, 0x060a, 0x0201, 0x0407, 0x0303, 0x0a1a, 0x0201, 0x0405, 0x0300, 0x0712, 0x0201, 0x0506, 0x0303, 0x0cff
+ },
+ // table 20 of 22
+ {
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7a,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c2c,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc0,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a87,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca0,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5a,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce0,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a2b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c90,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c48,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd0,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b31,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb0,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6a,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf0,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a24,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c88,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c38,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc8,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b28,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca8,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c62,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce8,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a42,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c98,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c52,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd8,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b49,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb8,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c72,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a18, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf8,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7e,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c34,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc4,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b1c,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca4,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5e,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce4,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a40,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c94,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c4e,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd4,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b44,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb4,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6e,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf4,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a26,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8c,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3c,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0ccc,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cac,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c66,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cec,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a85,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9c,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c56,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cdc,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b80,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cbc,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c76,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a1a, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cfc,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7c,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c30,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc2,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a87,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca2,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5c,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce2,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a2b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c92,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c4c,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd2,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b33,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb2,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6c,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf2,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a24,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8a,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3a,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cca,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2a,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0caa,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c64,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cea,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a42,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9a,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c54,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cda,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b4b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cba,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c74,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a18, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cfa,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c84,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c36,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc6,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b1e,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca6,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c60,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce6,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a40,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c96,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c50,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd6,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b46,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb6,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c70,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf6,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a26,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8e,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3e,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cce,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cae,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c68,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cee,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a85,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9e,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c58,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cde,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b82,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cbe,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c78,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a1a, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cfe,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7b,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c2e,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc1,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a87,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca1,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5b,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce1,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a2b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c91,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c4a,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd1,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b31,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb1,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6b,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf1,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a24,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c89,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c39,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc9,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b28,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca9,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c63,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce9,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a42,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c99,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c53,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd9,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b49,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb9,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c73,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a18, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf9,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7f,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c35,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc5,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b1c,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca5,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5f,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce5,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a40,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c95,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c4f,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd5,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b44,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb5,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6f,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf5,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a26,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8d,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3d,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0ccd,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cad,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c67,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ced,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a85,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9d,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c57,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cdd,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b80,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cbd,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c77,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a1a, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cfd,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1d,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c7d,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c32,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc3,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a87,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca3,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c5d,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce3,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a2b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c93,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c4d,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd3,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b33,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb3,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c6d,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf3,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a24,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8b,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3b,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0ccb,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2a,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cab,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c65,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ceb,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a42,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9b,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c55,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cdb,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b4b,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cbb,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c75,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a18, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cfb,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a1f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c86,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c37,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0920, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cc7,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b1e,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0ca7,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c61,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0947, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0ce7,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a40,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c97,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c51,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0929, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cd7,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b46,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0914, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cb7,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c71,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0983, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cf7,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a26,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0827, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c8f,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0812, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c3f,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0922, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0ccf,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080c, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b2f,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0843, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0caf,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x081b, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c69,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0981, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cef,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x0723, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0a85,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0841, 0x0201, 0x0407, 0x0303, 0x0710, 0x0201, 0x050b, 0x0402, 0x0c9f,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0819, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c59,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0945, 0x0201, 0x0407, 0x0303, 0x0717, 0x0201, 0x050b, 0x0402, 0x0cdf,
+  0x0201, 0x0405, 0x0303, 0x0608, 0x0201, 0x0504, 0x0400, 0x080e, 0x0201, 0x0407, 0x0303, 0x0611, 0x0201, 0x0509, 0x0402, 0x0b82,
+  0x0201, 0x0405, 0x0303, 0x060d, 0x0201, 0x0506, 0x0400, 0x0916, 0x0201, 0x0407, 0x0303, 0x0715, 0x0201, 0x050b, 0x0402, 0x0cbf,
+  0x0201, 0x0405, 0x0303, 0x060a, 0x0201, 0x0504, 0x0400, 0x0825, 0x0201, 0x0407, 0x0303, 0x0613, 0x0201, 0x0509, 0x0402, 0x0c79,
+  0x0201, 0x0405, 0x0303, 0x060f, 0x0201, 0x0506, 0x0400, 0x0a1a, 0x0201, 0x0407, 0x0303, 0x0721, 0x0201, 0x050b, 0x0402, 0x0cff
+ },
+ // table 21 of 22
+ {
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c78,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b80,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc0,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c58,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce0,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c90,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3a,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd0,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb0,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c68,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a18, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf0,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c84,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c2c,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc8,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b1c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c60,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce8,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c98,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c4c,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd8,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb8,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c70,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a24, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf8,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc4,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a87,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5c,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce4,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c94,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3e,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd4,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b44,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb4,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6c,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a1a, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf4,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a33,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c8c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c34,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0ccc,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b28,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cac,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c64,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cec,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a4b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9c,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c54,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cdc,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cbc,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c74,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a26, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cfc,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc2,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5a,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce2,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c92,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3c,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd2,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb2,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6a,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a18, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf2,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c88,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c30,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cca,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b1e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0caa,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c62,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cea,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c50,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cda,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cba,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c72,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a24, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cfa,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b8b,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc6,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a87,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5e,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce6,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c96,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c48,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd6,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb6,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6e,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a1a, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf6,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a33,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c8e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c38,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cce,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cae,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c66,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cee,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a4b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9e,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c56,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cde,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cbe,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c76,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a26, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cfe,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c79,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b80,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc1,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c59,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce1,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c91,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3b,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd1,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b35,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb1,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c69,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a18, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf1,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c86,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c2e,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc9,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b1c,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c61,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce9,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c99,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c4e,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd9,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b4d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb9,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c71,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a24, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf9,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b89,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc5,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a87,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5d,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce5,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c95,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3f,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd5,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b44,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb5,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6d,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a1a, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf5,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a33,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c8d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c36,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0ccd,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b28,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cad,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c65,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ced,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a4b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9d,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c55,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cdd,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b51,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cbd,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c75,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a26, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cfd,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2d,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7b,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b82,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc3,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a85,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5b,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce3,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a40,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c93,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c3d,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd3,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b37,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb3,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6b,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a18, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf3,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a31,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c8a,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c32,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0ccb,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b1e,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cab,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c63,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ceb,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a49,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9b,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c52,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cdb,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b4f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cbb,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c73,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a24, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cfb,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a2f,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c7f,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0b8b,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0929, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cc7,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a87,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091d, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0ca7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c5f,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0981, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0ce7,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a42,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0914, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c97,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c4a,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0945, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cd7,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b46,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0920, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cb7,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c6f,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a1a, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cf7,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080c, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a33,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0843, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c8f,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0819, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c39,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x092b, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0ccf,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0810, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b2a,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x091f, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0caf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0825, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c67,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0983, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cef,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x080e, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0a4b,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0916, 0x0203, 0x0502, 0x0301, 0x0715, 0x0203, 0x050f, 0x0307, 0x0c9f,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x081b, 0x0203, 0x0500, 0x0301, 0x0708, 0x0203, 0x050b, 0x0307, 0x0c57,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0947, 0x0203, 0x0502, 0x0301, 0x0723, 0x0203, 0x050f, 0x0307, 0x0cdf,
+  0x0203, 0x0405, 0x0301, 0x0604, 0x0203, 0x0506, 0x0307, 0x0812, 0x0203, 0x0500, 0x0301, 0x0617, 0x0203, 0x050b, 0x0307, 0x0b53,
+  0x0203, 0x0405, 0x0301, 0x0611, 0x0203, 0x0509, 0x0307, 0x0922, 0x0203, 0x0502, 0x0301, 0x0721, 0x0203, 0x050f, 0x0307, 0x0cbf,
+  0x0203, 0x0405, 0x0301, 0x060d, 0x0203, 0x0506, 0x0307, 0x0841, 0x0203, 0x0500, 0x0301, 0x070a, 0x0203, 0x050b, 0x0307, 0x0c77,
+  0x0203, 0x0405, 0x0301, 0x0613, 0x0203, 0x0509, 0x0307, 0x0a26, 0x0203, 0x0502, 0x0301, 0x0727, 0x0203, 0x050f, 0x0307, 0x0cff
+ }
+};
+
+template<typename T>
+const uint16_t cpc_decoding_data<T>::length_limited_unary_decoding_table65[4096] = {
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a08,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c21,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c11,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c31,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0b0a,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c29,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c19,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c39,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a09,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c25,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c15,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c35,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c0d,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2d,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1d,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3d,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a08,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c23,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c13,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c33,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c0b,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2b,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1b,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3b,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a09,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c27,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c17,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c37,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c0f,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2f,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1f,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3f,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a08,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c22,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c12,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c32,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0b0a,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2a,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1a,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3a,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a09,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c26,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c16,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c36,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c0e,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2e,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1e,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3e,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a08,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c24,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c14,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c34,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c0c,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c2c,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c1c,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c3c,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0a09,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c28,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c18,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c38,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c10,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0806,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c30,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0705,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c20,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0807,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0504,
+  0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0403, 0x0100, 0x0201, 0x0100, 0x0302, 0x0100, 0x0201, 0x0100, 0x0c40
+};
+
+template<typename T>
+const uint8_t cpc_decoding_data<T>::column_permutations_for_decoding[16][56] = {
+  {0, 1, 2, 3, 55, 4, 5, 6, 7, 8, 9, 10, 11, 12, 54, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 53, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 3, 55, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 54, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 53, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 3, 4, 55, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 54, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 53, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 3, 4, 55, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 54, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 53,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 3, 4, 5, 55, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 54, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+   38, 53, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 3, 4, 5, 55, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 54,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+   38, 39, 40, 53, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {55, 0, 1, 2, 3, 4, 5, 54, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   53, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 52, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51},
+  {55, 0, 1, 2, 3, 4, 5, 54, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 53, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 52, 44, 45, 46, 47, 48, 49, 50, 51},
+  {55, 0, 1, 2, 3, 4, 5, 6, 54, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 53, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 52, 47, 48, 49, 50, 51},
+  {0, 55, 1, 2, 3, 4, 5, 6, 7, 54, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 53, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 52, 49, 50, 51},
+  {0, 55, 1, 2, 3, 4, 5, 6, 7, 54, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 53, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 55, 1, 2, 3, 4, 5, 6, 7, 8, 54, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 53, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 55, 2, 3, 4, 5, 6, 7, 8, 9, 54, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 53, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 55, 2, 3, 4, 5, 6, 7, 8, 9, 54, 10, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 53, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 55, 3, 4, 5, 6, 7, 8, 9, 10, 54, 11, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 53, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52},
+  {0, 1, 2, 55, 3, 4, 5, 6, 7, 8, 9, 10, 11, 54, 12, 13, 14, 15, 16, 17,
+   18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 53, 30, 31, 32, 33, 34, 35, 36,
+   37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52}
+};
+
+} /* namespace datasketches */
+
+#endif
@@ -35,12 +35,25 @@ static const uint32_t U32_TABLE_UPSIZE_DENOM = 4LL;
 static const uint32_t U32_TABLE_DOWNSIZE_NUMER = 1LL;
 static const uint32_t U32_TABLE_DOWNSIZE_DENOM = 4LL;
 
+// tables up to this size keep the slots inline, in the space of the heap pointer,
+// so that small sparse sketches (up to 3 coupons) need no heap allocation
+static const uint8_t U32_TABLE_INLINE_LG_SIZE = 2;
+
+// below this length shell sort is faster than radix sort on badly ordered input
+static const size_t U32_TABLE_RADIX_SORT_THRESHOLD = 256;
+
 template<typename A>
 class u32_table {
 public:
 
   u32_table(const A& allocator);
   u32_table(uint8_t lg_size, uint8_t num_valid_bits, const A& allocator);
+  u32_table(const u32_table& other);
+  u32_table(u32_table&& other) noexcept;
+  ~u32_table();
+
+  u32_table& operator=(const u32_table& other);
+  u32_table& operator=(u32_table&& other) noexcept;
 
   inline uint32_t get_num_items() const;
   inline const uint32_t* get_slots() const;
@@ -51,6 +64,8 @@ public:
   inline bool maybe_insert(uint32_t item);
   // returns true iff the item was present and was therefore removed from the table
   inline bool maybe_delete(uint32_t item);
+  // hints the processor to load the slot where a lookup of the item starts
+  inline void prefetch(uint32_t item) const;
 
   static u32_table make_from_pairs(const uint32_t* pairs, uint32_t num_pairs, uint8_t lg_k, const A& allocator);
 
@@ -64,17 +79,40 @@ public:
 
   static void introspective_insertion_sort(uint32_t* a, size_t l, size_t r);
   static void knuth_shell_sort3(uint32_t* a, size_t l, size_t r);
+  // sorts items with at most num_valid_bits bits, using a scratch buffer of the same length
+  static void radix_sort(uint32_t* a, size_t length, uint8_t num_valid_bits, const A& allocator);
+  // insertion sort for nearly sorted input, otherwise shell sort or radix sort depending on the length
+  static void sort_items(uint32_t* a, size_t length, uint8_t num_valid_bits, const A& allocator);
 
 private:
 
+  // the allocator is a base class so that it takes no space when it has no state
+  // lg_size tells which member of the union is active
+  struct slot_storage: AllocU32<A> {
+    union {
+      uint32_t* heap_slots;
+      uint32_t inline_slots[1 << U32_TABLE_INLINE_LG_SIZE];
+    };
+    explicit slot_storage(const A& allocator): AllocU32<A>(allocator) {}
+  };
+
   uint8_t lg_size; // log2 of number of slots
   uint8_t num_valid_bits;
   uint32_t num_items;
-  vector_u32<A> slots;
+  slot_storage storage;
+
+  inline bool is_inline() const;
+  inline uint32_t* slot_data();
+  inline const uint32_t* slot_data() const;
+  // allocates the slots for the current lg_size and fills them with UINT32_MAX
+  inline void allocate_slots();
+  inline void deallocate_slots();
 
   inline uint32_t lookup(uint32_t item) const;
   inline void must_insert(uint32_t item);
   inline void rebuild(uint8_t new_lg_size);
+
+  static bool bounded_insertion_sort(uint32_t* a, size_t l, size_t r);
 };
 
 } /* namespace datasketches */
@@ -33,18 +33,104 @@ u32_table<A>::u32_table(const A& allocator):
 lg_size(0),
 num_valid_bits(0),
 num_items(0),
-slots(allocator)
-{}
+storage(allocator)
+{
+  allocate_slots();
+}
 
 template<typename A>
 u32_table<A>::u32_table(uint8_t lg_size, uint8_t num_valid_bits, const A& allocator):
 lg_size(lg_size),
 num_valid_bits(num_valid_bits),
 num_items(0),
-slots(1ULL << lg_size, UINT32_MAX, allocator)
+storage(allocator)
 {
   if (lg_size < 2) throw std::invalid_argument("lg_size must be >= 2");
   if (num_valid_bits < 1 || num_valid_bits > 32) throw std::invalid_argument("num_valid_bits must be between 1 and 32");
+  allocate_slots();
+}
+
+template<typename A>
+u32_table<A>::u32_table(const u32_table& other):
+lg_size(other.lg_size),
+num_valid_bits(other.num_valid_bits),
+num_items(other.num_items),
+storage(other.storage)
+{
+  if (!is_inline()) {
+    storage.heap_slots = storage.allocate(1ULL << lg_size);
+    std::copy(other.storage.heap_slots, other.storage.heap_slots + (1ULL << lg_size), storage.heap_slots);
+  }
+}
+
+// the other table is left empty with inline slots
+template<typename A>
+u32_table<A>::u32_table(u32_table&& other) noexcept:
+lg_size(other.lg_size),
+num_valid_bits(other.num_valid_bits),
+num_items(other.num_items),
+storage(other.storage)
+{
+  other.lg_size = 0;
+  other.num_items = 0;
+  std::fill(other.storage.inline_slots, other.storage.inline_slots + (1 << U32_TABLE_INLINE_LG_SIZE), UINT32_MAX);
+}
+
+template<typename A>
+u32_table<A>::~u32_table() {
+  deallocate_slots();
+}
+
+template<typename A>
+u32_table<A>& u32_table<A>::operator=(const u32_table& other) {
+  u32_table copy(other);
+  *this = std::move(copy);
+  return *this;
+}
+
+template<typename A>
+u32_table<A>& u32_table<A>::operator=(u32_table&& other) noexcept {
+  if (this != &other) {
+    deallocate_slots();
+    lg_size = other.lg_size;
+    num_valid_bits = other.num_valid_bits;
+    num_items = other.num_items;
+    storage = other.storage;
+    other.lg_size = 0;
+    other.num_items = 0;
+    std::fill(other.storage.inline_slots, other.storage.inline_slots + (1 << U32_TABLE_INLINE_LG_SIZE), UINT32_MAX);
+  }
+  return *this;
+}
+
+template<typename A>
+bool u32_table<A>::is_inline() const {
+  return lg_size <= U32_TABLE_INLINE_LG_SIZE;
+}
+
+template<typename A>
+uint32_t* u32_table<A>::slot_data() {
+  return is_inline() ? storage.inline_slots : storage.heap_slots;
+}
+
+template<typename A>
+const uint32_t* u32_table<A>::slot_data() const {
+  return is_inline() ? storage.inline_slots : storage.heap_slots;
+}
+
+template<typename A>
+void u32_table<A>::allocate_slots() {
+  if (is_inline()) {
+    std::fill(storage.inline_slots, storage.inline_slots + (1 << U32_TABLE_INLINE_LG_SIZE), UINT32_MAX);
+  } else {
+    storage.heap_slots = storage.allocate(1ULL << lg_size);
+    std::fill(storage.heap_slots, storage.heap_slots + (1ULL << lg_size), UINT32_MAX);
+  }
+}
+
+template<typename A>
+void u32_table<A>::deallocate_slots() {
+  if (!is_inline()) storage.deallocate(storage.heap_slots, 1ULL << lg_size);
 }
 
 template<typename A>
@@ -54,7 +140,7 @@ uint32_t u32_table<A>::get_num_items() const {
 
 template<typename A>
 const uint32_t* u32_table<A>::get_slots() const {
-  return slots.data();
+  return slot_data();
 }
 
 template<typename A>
@@ -64,12 +150,14 @@ uint8_t u32_table<A>::get_lg_size() const {
 
 template<typename A>
 void u32_table<A>::clear() {
-  std::fill(slots.begin(), slots.end(), UINT32_MAX);
+  uint32_t* slots = slot_data();
+  std::fill(slots, slots + (1 << lg_size), UINT32_MAX);
   num_items = 0;
 }
 
 template<typename A>
 bool u32_table<A>::maybe_insert(uint32_t item) {
+  uint32_t* slots = slot_data();
   const uint32_t index = lookup(item);
   if (slots[index] == item) return false;
   if (slots[index] != UINT32_MAX) throw std::logic_error("could not insert");
@@ -83,6 +171,7 @@ bool u32_table<A>::maybe_insert(uint32_t item) {
 
 template<typename A>
 bool u32_table<A>::maybe_delete(uint32_t item) {
+  uint32_t* slots = slot_data();
   const uint32_t index = lookup(item);
   if (slots[index] == UINT32_MAX) return false;
   if (slots[index] != item) throw std::logic_error("item does not exist");
@@ -108,6 +197,15 @@ bool u32_table<A>::maybe_delete(uint32_t item) {
   return true;
 }
 
+template<typename A>
+void u32_table<A>::prefetch(uint32_t item) const {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(slot_data() + (item >> (num_valid_bits - lg_size)));
+#else
+  unused(item);
+#endif
+}
+
 // this one is specifically tailored to be a part of fm85 decompression scheme
 template<typename A>
 u32_table<A> u32_table<A>::make_from_pairs(const uint32_t* pairs, uint32_t num_pairs, uint8_t lg_k, const A& allocator) {
@@ -130,6 +228,7 @@ uint32_t u32_table<A>::lookup(uint32_t item) const {
   const uint8_t shift = num_valid_bits - lg_size;
   uint32_t probe = item >> shift;
   if (probe > mask) throw std::logic_error("probe out of range");
+  const uint32_t* slots = slot_data();
   while (slots[probe] != item && slots[probe] != UINT32_MAX) {
     probe = (probe + 1) & mask;
   }
@@ -139,6 +238,7 @@ uint32_t u32_table<A>::lookup(uint32_t item) const {
 // counts and resizing must be handled by the caller
 template<typename A>
 void u32_table<A>::must_insert(uint32_t item) {
+  uint32_t* slots = slot_data();
   const uint32_t index = lookup(item);
   if (slots[index] == item) throw std::logic_error("item exists");
   if (slots[index] != UINT32_MAX) throw std::logic_error("could not insert");
@@ -151,14 +251,28 @@ void u32_table<A>::rebuild(uint8_t new_lg_size) {
   const uint32_t old_size = 1 << lg_size;
   const uint32_t new_size = 1 << new_lg_size;
   if (new_size <= num_items) throw std::logic_error("new_size <= num_items");
-  vector_u32<A> old_slots = std::move(slots);
-  slots = vector_u32<A>(new_size, UINT32_MAX, old_slots.get_allocator());
+  const uint8_t old_lg_size = lg_size;
+  const bool was_inline = is_inline();
+  uint32_t old_inline_slots[1 << U32_TABLE_INLINE_LG_SIZE];
+  uint32_t* old_slots = old_inline_slots;
+  if (was_inline) {
+    std::copy(storage.inline_slots, storage.inline_slots + (1 << U32_TABLE_INLINE_LG_SIZE), old_inline_slots);
+  } else {
+    old_slots = storage.heap_slots;
+  }
   lg_size = new_lg_size;
+  try {
+    allocate_slots();
+  } catch (...) {
+    lg_size = old_lg_size;
+    throw;
+  }
   for (uint32_t i = 0; i < old_size; i++) {
     if (old_slots[i] != UINT32_MAX) {
       must_insert(old_slots[i]);
     }
   }
+  if (!was_inline) storage.deallocate(old_slots, old_size);
 }
 
 // While extracting the items from a linear probing hashtable,
@@ -169,9 +283,11 @@ void u32_table<A>::rebuild(uint8_t new_lg_size) {
 // The result is nearly sorted, so make sure to use an efficient sort for that case
 template<typename A>
 vector_u32<A> u32_table<A>::unwrapping_get_items() const {
-  if (num_items == 0) return vector_u32<A>(slots.get_allocator());
+  const AllocU32<A>& allocator = storage;
+  if (num_items == 0) return vector_u32<A>(allocator);
   const uint32_t table_size = 1 << lg_size;
-  vector_u32<A> result(num_items, 0, slots.get_allocator());
+  const uint32_t* slots = slot_data();
+  vector_u32<A> result(num_items, 0, allocator);
   size_t i = 0;
   size_t l = 0;
   size_t r = num_items - 1;
@@ -225,6 +341,12 @@ void u32_table<A>::merge(
 
 template<typename A>
 void u32_table<A>::introspective_insertion_sort(uint32_t* a, size_t l, size_t r) { // r points past the rightmost element
+  if (!bounded_insertion_sort(a, l, r)) knuth_shell_sort3(a, l, r);
+}
+
+// returns false if the work limit was exceeded, leaving the array partially sorted
+template<typename A>
+bool u32_table<A>::bounded_insertion_sort(uint32_t* a, size_t l, size_t r) {
   const size_t length = r - l;
   const size_t cost_limit = 8 * length;
   size_t cost = 0;
@@ -237,11 +359,9 @@ void u32_table<A>::introspective_insertion_sort(uint32_t* a, size_t l, size_t r)
     }
     a[j] = v;
     cost += i - j; // distance moved is a measure of work
-    if (cost > cost_limit) {
-      knuth_shell_sort3(a, l, r);
-      return;
-    }
+    if (cost > cost_limit) return false;
   }
+  return true;
 }
 
 template<typename A>
@@ -261,6 +381,51 @@ void u32_table<A>::knuth_shell_sort3(uint32_t* a, size_t l, size_t r) {
   }
 }
 
+// Least significant digit radix sort with 8-bit digits.
+// Only as many passes as needed for num_valid_bits are made,
+// and a pass is skipped if all items have the same digit in it.
+template<typename A>
+void u32_table<A>::radix_sort(uint32_t* a, size_t length, uint8_t num_valid_bits, const A& allocator) {
+  if (length < 2) return;
+  const unsigned num_passes = (num_valid_bits + 7) / 8;
+  size_t counts[4][256];
+  std::fill(&counts[0][0], &counts[0][0] + 4 * 256, 0);
+  for (size_t i = 0; i < length; i++) {
+    const uint32_t item = a[i];
+    for (unsigned pass = 0; pass < num_passes; pass++) counts[pass][(item >> (8 * pass)) & 0xff]++;
+  }
+  vector_u32<A> scratch(length, 0, allocator);
+  uint32_t* src = a;
+  uint32_t* dst = scratch.data();
+  for (unsigned pass = 0; pass < num_passes; pass++) {
+    size_t* count = counts[pass];
+    if (count[(src[0] >> (8 * pass)) & 0xff] == length) continue;
+    size_t offset = 0;
+    for (unsigned digit = 0; digit < 256; digit++) {
+      const size_t n = count[digit];
+      count[digit] = offset;
+      offset += n;
+    }
+    for (size_t i = 0; i < length; i++) {
+      const uint32_t item = src[i];
+      dst[count[(item >> (8 * pass)) & 0xff]++] = item;
+    }
+    std::swap(src, dst);
+  }
+  if (src != a) std::copy(src, src + length, a);
+}
+
+// Same as introspective_insertion_sort, but falls back to radix sort for longer arrays
+template<typename A>
+void u32_table<A>::sort_items(uint32_t* a, size_t length, uint8_t num_valid_bits, const A& allocator) {
+  if (bounded_insertion_sort(a, 0, length)) return;
+  if (length < U32_TABLE_RADIX_SORT_THRESHOLD) {
+    knuth_shell_sort3(a, 0, length);
+  } else {
+    radix_sort(a, length, num_valid_bits, allocator);
+  }
+}
+
 } /* namespace datasketches */
 
 #endif
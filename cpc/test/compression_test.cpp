@@ -19,8 +19,14 @@
 
 #include <catch2/catch.hpp>
 #include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
 
 #include "cpc_compressor.hpp"
+#include "cpc_sketch.hpp"
+#include "u32_table.hpp"
 
 namespace datasketches {
 
@@ -64,4 +70,169 @@ TEST_CASE("cpc sketch: compress and decompress pairs", "[cpc_sketch]") {
   }
 }
 
+TEST_CASE("cpc sketch: decompress truncated pairs", "[cpc_sketch]") {
+  // few pairs far apart, so that the unary codes of row deltas span several words
+  const uint32_t numPairs = 4;
+  const uint32_t pairArray[numPairs] = {(1000 << 6) | 3, (3000 << 6) | 1, (3001 << 6) | 63, (9000 << 6)};
+  uint32_t pairArray2[numPairs];
+  uint32_t compressedWords[1000];
+  const uint32_t numWordsWritten = get_compressor<std::allocator<void>>().low_level_compress_pairs(pairArray, numPairs, 0, compressedWords);
+  get_compressor<std::allocator<void>>().low_level_uncompress_pairs(pairArray2, numPairs, 0, compressedWords, numWordsWritten);
+  REQUIRE(std::equal(pairArray, pairArray + numPairs, pairArray2));
+  for (uint32_t numWords = 0; numWords < numWordsWritten - 1; numWords++) {
+    REQUIRE_THROWS_AS(
+      get_compressor<std::allocator<void>>().low_level_uncompress_pairs(pairArray2, numPairs, 0, compressedWords, numWords),
+      std::logic_error
+    );
+  }
+}
+
+static void check_decoding_table(const uint16_t* decoding_table, const uint16_t* encoding_table) {
+  for (int decode_this = 0; decode_this < 4096; decode_this++) {
+    const int tmp_d = decoding_table[decode_this];
+    const int decoded_byte = tmp_d & 0xff;
+    const int decoded_length = tmp_d >> 8;
+
+    const int tmp_e = encoding_table[decoded_byte];
+    const int encoded_bit_pattern = tmp_e & 0xfff;
+    const int encoded_length = tmp_e >> 12;
+
+    REQUIRE(decoded_length == encoded_length);
+    REQUIRE(encoded_bit_pattern == (decode_this & ((1 << decoded_length) - 1)));
+  }
+}
+
+TEST_CASE("cpc sketch: decoding tables", "[cpc_sketch]") {
+  check_decoding_table(decompression_data::length_limited_unary_decoding_table65, length_limited_unary_encoding_table65);
+  for (int i = 0; i < (16 + 6); i++) {
+    check_decoding_table(decompression_data::decoding_tables_for_high_entropy_byte[i], encoding_tables_for_high_entropy_byte[i]);
+  }
+  for (int i = 0; i < 16; i++) {
+    for (uint8_t j = 0; j < 56; j++) {
+      REQUIRE(decompression_data::column_permutations_for_decoding[i][column_permutations_for_encoding[i][j]] == j);
+    }
+  }
+}
+
+TEST_CASE("cpc sketch: sort items", "[cpc_sketch]") {
+  const uint8_t num_valid_bits = 26;
+  for (size_t n: {0, 1, 100, 300, 5000}) {
+    std::vector<uint32_t> random_items(n);
+    uint64_t value = 35538947;
+    for (size_t i = 0; i < n; i++) {
+      HashState hashes;
+      MurmurHash3_x64_128(&value, sizeof(value), 0, hashes);
+      random_items[i] = hashes.h1 & ((1 << num_valid_bits) - 1);
+      value++;
+    }
+    std::vector<uint32_t> expected(random_items);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<uint32_t> items(random_items);
+    table::radix_sort(items.data(), items.size(), num_valid_bits, std::allocator<void>());
+    REQUIRE(items == expected);
+
+    items = random_items;
+    table::sort_items(items.data(), items.size(), num_valid_bits, std::allocator<void>());
+    REQUIRE(items == expected);
+
+    // nearly sorted
+    std::vector<uint32_t> nearly_sorted(expected);
+    for (size_t i = 1; i < n; i += 7) std::swap(nearly_sorted[i - 1], nearly_sorted[i]);
+    table::sort_items(nearly_sorted.data(), nearly_sorted.size(), num_valid_bits, std::allocator<void>());
+    REQUIRE(nearly_sorted == expected);
+  }
+}
+
+// the flavor boundaries of cpc_sketch_alloc::determine_flavor()
+static const char* flavor_name(uint8_t lg_k, uint64_t c) {
+  const uint64_t k = 1 << lg_k;
+  if (c == 0) return "EMPTY";
+  if (32 * c < 3 * k) return "SPARSE";
+  if (2 * c < k) return "HYBRID";
+  if (8 * c < 27 * k) return "PINNED";
+  return "SLIDING";
+}
+
+// not run by default: ./cpc_test "[benchmark]"
+// uses the public interface of the compressor only, so that it can be run on older revisions as well
+TEST_CASE("cpc sketch: benchmark uncompress", "[.][benchmark]") {
+  std::cout << "lg_k\tflavor\tcoupons\tns/uncompress\tns/coupon" << std::endl;
+  for (uint8_t lg_k: {8, 11, 14, 17}) {
+    const uint32_t k = 1 << lg_k;
+    // sizes land in EMPTY, SPARSE, HYBRID, PINNED and SLIDING
+    const uint64_t sizes[] = {0, k / 16, k / 4, 2 * k, 32 * k};
+    for (size_t f = 0; f < 5; ++f) {
+      cpc_sketch sketch(lg_k);
+      for (uint64_t i = 0; i < sizes[f]; ++i) sketch.update(i);
+      const uint32_t num_coupons = sketch.get_num_coupons();
+      compressed_state<std::allocator<uint8_t>> compressed(std::allocator<uint8_t>{});
+      get_compressor<std::allocator<uint8_t>>().compress(sketch, compressed);
+
+      // about the same number of coupons decoded at every lg_k
+      const size_t num_runs = std::max<size_t>(16, (size_t(1) << 26) >> lg_k);
+      uint64_t checksum = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < num_runs; ++i) {
+        uncompressed_state<std::allocator<uint8_t>> uncompressed(std::allocator<uint8_t>{});
+        get_compressor<std::allocator<uint8_t>>().uncompress(compressed, uncompressed, lg_k, num_coupons);
+        checksum += uncompressed.table.get_num_items() + uncompressed.window.size();
+      }
+      const auto finish = std::chrono::steady_clock::now();
+      const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / num_runs;
+      std::cout << static_cast<int>(lg_k) << "\t" << flavor_name(lg_k, num_coupons) << "\t" << num_coupons << "\t" << ns
+          << "\t" << (num_coupons > 0 ? ns / num_coupons : 0) << std::endl;
+      REQUIRE((checksum > 0 || num_coupons == 0));
+    }
+  }
+}
+
+// not run by default: ./cpc_test "[benchmark]"
+// pairs come out of the hash table in random order, the radix sort is used from U32_TABLE_RADIX_SORT_THRESHOLD on
+TEST_CASE("cpc sketch: benchmark sort pairs", "[.][benchmark]") {
+  std::cout << "threshold: " << U32_TABLE_RADIX_SORT_THRESHOLD << std::endl;
+  std::cout << "lg_k\tpairs\tns/pair shell\tns/pair radix" << std::endl;
+  // around the threshold, then the largest SPARSE (3k/32) and HYBRID (k/2) pair counts at lg_k 14 and 20
+  const std::pair<uint8_t, size_t> cases[] = {
+    {11, 64}, {11, 128}, {11, 192}, {11, 256}, {11, 384}, {11, 512}, {11, 1024},
+    {14, 1536}, {14, 8192}, {20, 98304}, {20, 524288}
+  };
+  for (const auto& c: cases) {
+    const uint8_t num_valid_bits = 6 + c.first;
+    const size_t num_pairs = c.second;
+    std::vector<uint32_t> random_pairs(num_pairs);
+    uint64_t value = 35538947;
+    for (size_t i = 0; i < num_pairs; i++) {
+      HashState hashes;
+      MurmurHash3_x64_128(&value, sizeof(value), 0, hashes);
+      random_pairs[i] = hashes.h1 & ((1 << num_valid_bits) - 1);
+      value++;
+    }
+    const size_t num_runs = std::max<size_t>(4, (size_t(1) << 24) / num_pairs);
+    std::vector<uint32_t> pairs(num_pairs);
+    uint64_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_runs; ++i) {
+      pairs = random_pairs;
+      table::knuth_shell_sort3(pairs.data(), 0, num_pairs);
+      checksum += pairs[num_pairs / 2];
+    }
+    auto finish = std::chrono::steady_clock::now();
+    const double shell_ns = std::chrono::duration<double, std::nano>(finish - start).count() / num_runs / num_pairs;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_runs; ++i) {
+      pairs = random_pairs;
+      table::radix_sort(pairs.data(), num_pairs, num_valid_bits, std::allocator<void>());
+      checksum -= pairs[num_pairs / 2];
+    }
+    finish = std::chrono::steady_clock::now();
+    const double radix_ns = std::chrono::duration<double, std::nano>(finish - start).count() / num_runs / num_pairs;
+
+    std::cout << static_cast<int>(c.first) << "\t" << num_pairs << "\t" << shell_ns << "\t" << radix_ns << std::endl;
+    REQUIRE(checksum == 0);
+  }
+}
+
 } /* namespace datasketches */
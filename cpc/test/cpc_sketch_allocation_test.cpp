@@ -21,6 +21,10 @@
 #include <cstring>
 #include <sstream>
 #include <fstream>
+#include <vector>
+#include <cmath>
+#include <iostream>
+#include <random>
 
 #include <catch2/catch.hpp>
 
@@ -251,4 +255,98 @@ TEST_CASE("cpc sketch allocation: union") {
   REQUIRE_FALSE(s3.is_empty());
 }
 
+TEST_CASE("cpc sketch allocation: union bulk update with threads", "[cpc_union]") {
+  // test_allocator is not thread-safe, so this relies on the workers not allocating
+  test_allocator_total_bytes = 0;
+  test_allocator_net_allocations = 0;
+  {
+    std::vector<cpc_sketch_test_alloc> sketches;
+    for (uint8_t lg_k: {11, 12}) {
+      cpc_sketch_test_alloc sketch(lg_k, DEFAULT_SEED, 0);
+      for (int i = 0; i < 20000; i++) sketch.update(i * lg_k);
+      sketches.push_back(std::move(sketch));
+    }
+    cpc_union_test_alloc u1(11, DEFAULT_SEED, 0);
+    for (const auto& sketch: sketches) u1.update(sketch);
+    cpc_union_test_alloc u2(11, DEFAULT_SEED, 0);
+    u2.update(sketches.begin(), sketches.end(), 4);
+    REQUIRE(u2.get_result().serialize() == u1.get_result().serialize());
+  }
+  REQUIRE(test_allocator_total_bytes == 0);
+  REQUIRE(test_allocator_net_allocations == 0);
+}
+
+TEST_CASE("cpc sketch allocation: small sketch does not allocate", "[cpc_sketch]") {
+  test_allocator_total_bytes = 0;
+  test_allocator_net_allocations = 0;
+  {
+    cpc_sketch_test_alloc sketch(11, DEFAULT_SEED, 0);
+    for (int i = 0; i < 3; i++) sketch.update(i);
+    REQUIRE(sketch.get_estimate() == Approx(3).margin(0.01));
+    REQUIRE(sketch.validate());
+    cpc_sketch_test_alloc copy(sketch);
+    REQUIRE(test_allocator_net_allocations == 0);
+
+    // promotion to the heap with more coupons
+    for (int i = 0; i < 100; i++) sketch.update(i);
+    REQUIRE(test_allocator_net_allocations > 0);
+    REQUIRE(sketch.get_estimate() == Approx(100).margin(100 * 0.02));
+    REQUIRE(sketch.validate());
+    REQUIRE(copy.get_estimate() == Approx(3).margin(0.01));
+
+    // merging small sketches
+    cpc_union_alloc<alloc> u(11, DEFAULT_SEED, alloc(0));
+    u.update(copy);
+    REQUIRE(u.get_result().get_estimate() == Approx(3).margin(0.01));
+  }
+  REQUIRE(test_allocator_total_bytes == 0);
+  REQUIRE(test_allocator_net_allocations == 0);
+}
+
+TEST_CASE("cpc sketch allocation: inline table slots take no extra space", "[cpc_sketch]") {
+  // the layout of the table when the slots were always in a vector
+  struct vector_table {
+    uint8_t lg_size;
+    uint8_t num_valid_bits;
+    uint32_t num_items;
+    std::vector<uint32_t> slots;
+  };
+  REQUIRE(sizeof(u32_table<std::allocator<uint8_t>>) <= sizeof(vector_table));
+}
+
+// not run by default: ./cpc_test "[benchmark]"
+TEST_CASE("cpc sketch allocation: benchmark footprint", "[.][benchmark]") {
+  const uint8_t lg_k = 11;
+  std::cout << "sizeof(cpc_sketch): " << sizeof(cpc_sketch_test_alloc) << std::endl;
+  for (int n: {0, 1, 2, 3, 4, 6, 8, 16, 100, 1000, 10000}) {
+    test_allocator_total_bytes = 0;
+    cpc_sketch_test_alloc sketch(lg_k, DEFAULT_SEED, 0);
+    for (int i = 0; i < n; i++) sketch.update(i);
+    std::cout << "n=" << n << ": heap bytes " << test_allocator_total_bytes << std::endl;
+  }
+
+  // many sketches with a long tail of small ones, such as one sketch per key:
+  // log-uniform number of distinct items from 0 to 100000
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> exponent(0, std::log(100001.0));
+  const size_t num_sketches = 1000;
+  test_allocator_total_bytes = 0;
+  size_t num_without_heap = 0;
+  {
+    std::vector<cpc_sketch_test_alloc> sketches;
+    sketches.reserve(num_sketches);
+    uint64_t value = 0;
+    for (size_t i = 0; i < num_sketches; i++) {
+      const int64_t before = test_allocator_total_bytes;
+      sketches.emplace_back(lg_k, DEFAULT_SEED, 0);
+      const uint64_t n = static_cast<uint64_t>(std::exp(exponent(gen))) - 1;
+      for (uint64_t j = 0; j < n; j++) sketches.back().update(value++);
+      if (test_allocator_total_bytes == before) num_without_heap++;
+    }
+    const double heap_bytes = static_cast<double>(test_allocator_total_bytes);
+    std::cout << num_sketches << " sketches: " << num_without_heap << " without heap memory, "
+        << (sizeof(cpc_sketch_test_alloc) + heap_bytes / num_sketches) << " bytes per sketch on average" << std::endl;
+  }
+}
+
 } /* namespace datasketches */
@@ -22,10 +22,12 @@
 #include <sstream>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
 #include "cpc_sketch.hpp"
+#include "cpc_union.hpp"
 
 namespace datasketches {
 
@@ -399,6 +401,82 @@ TEST_CASE("cpc sketch: update string equivalence", "[cpc_sketch]") {
   REQUIRE(sketch.get_estimate() == Approx(1).margin(RELATIVE_ERROR_FOR_LG_K_11));
 }
 
+TEST_CASE("cpc sketch: batch update equivalence", "[cpc_sketch]") {
+  // sizes cover all flavors including several window moves, and are not multiples of the batch size
+  for (uint8_t lg_k: {4, 8, 11}) {
+    for (uint64_t n: {0, 1, 100, 1000, 10001, 100003}) {
+      std::vector<uint64_t> values(n);
+      for (uint64_t i = 0; i < n; ++i) values[i] = i * 7 + lg_k;
+      cpc_sketch sketch1(lg_k);
+      for (uint64_t value: values) sketch1.update(value);
+      cpc_sketch sketch2(lg_k);
+      sketch2.update_batch(values.data(), n / 3);
+      sketch2.update_batch(values.data() + n / 3, n - n / 3);
+      REQUIRE(sketch2.validate());
+      REQUIRE(sketch2.get_num_coupons() == sketch1.get_num_coupons());
+      REQUIRE(sketch2.get_estimate() == sketch1.get_estimate());
+      REQUIRE(sketch2.serialize() == sketch1.serialize());
+    }
+  }
+}
+
+TEST_CASE("cpc sketch: batch update strings", "[cpc_sketch]") {
+  std::vector<std::string> values;
+  for (int i = 0; i < 5000; ++i) values.push_back(i % 10 == 0 ? std::string() : std::to_string(i));
+  cpc_sketch sketch1(10);
+  for (const auto& value: values) sketch1.update(value);
+  cpc_sketch sketch2(10);
+  sketch2.update_batch(values.data(), values.size());
+  REQUIRE(sketch2.get_estimate() == sketch1.get_estimate());
+  REQUIRE(sketch2.serialize() == sketch1.serialize());
+}
+
+TEST_CASE("cpc sketch: wrapped", "[cpc_sketch]") {
+  // all flavors
+  for (uint64_t n: {0, 10, 100, 500, 2000, 20000}) {
+    cpc_sketch sketch(10);
+    for (uint64_t i = 0; i < n; i++) sketch.update(i);
+    auto bytes = sketch.serialize();
+    auto wrapped = wrapped_cpc_sketch::wrap(bytes.data(), bytes.size());
+    REQUIRE(wrapped.get_lg_k() == 10);
+    REQUIRE(wrapped.is_empty() == sketch.is_empty());
+    REQUIRE(wrapped.get_num_coupons() == sketch.get_num_coupons());
+    REQUIRE(wrapped.get_estimate() == sketch.get_estimate());
+    for (unsigned kappa = 1; kappa <= 3; kappa++) {
+      REQUIRE(wrapped.get_lower_bound(kappa) == sketch.get_lower_bound(kappa));
+      REQUIRE(wrapped.get_upper_bound(kappa) == sketch.get_upper_bound(kappa));
+    }
+    auto unwrapped = wrapped.to_sketch();
+    REQUIRE(unwrapped.validate());
+    REQUIRE(unwrapped.serialize() == bytes);
+  }
+}
+
+TEST_CASE("cpc sketch: wrapped merged", "[cpc_sketch]") {
+  cpc_sketch sketch(11);
+  for (int i = 0; i < 10000; i++) sketch.update(i);
+  cpc_union u(11);
+  u.update(sketch);
+  auto result = u.get_result();
+  auto bytes = result.serialize();
+  auto wrapped = wrapped_cpc_sketch::wrap(bytes.data(), bytes.size());
+  REQUIRE(wrapped.get_estimate() == result.get_estimate());
+  REQUIRE(wrapped.get_lower_bound(2) == result.get_lower_bound(2));
+  REQUIRE(wrapped.get_upper_bound(2) == result.get_upper_bound(2));
+  REQUIRE_THROWS_AS(wrapped.get_lower_bound(0), std::invalid_argument);
+  cpc_union u2(11);
+  u2.update(wrapped.to_sketch());
+  REQUIRE(u2.get_result().get_estimate() == result.get_estimate());
+}
+
+TEST_CASE("cpc sketch: wrapped corrupted", "[cpc_sketch]") {
+  cpc_sketch sketch(11);
+  for (int i = 0; i < 1000; i++) sketch.update(i);
+  auto bytes = sketch.serialize();
+  REQUIRE_THROWS_AS(wrapped_cpc_sketch::wrap(bytes.data(), bytes.size() - 1), std::out_of_range);
+  REQUIRE_THROWS_AS(wrapped_cpc_sketch::wrap(bytes.data(), bytes.size(), 123), std::invalid_argument);
+}
+
 TEST_CASE("cpc sketch: max serialized size", "[cpc_sketch]") {
   REQUIRE(cpc_sketch::get_max_serialized_size_bytes(4) == 24 + 40);
   REQUIRE(cpc_sketch::get_max_serialized_size_bytes(26) == static_cast<size_t>((0.6 * (1 << 26)) + 40));
@@ -22,6 +22,7 @@
 #include "cpc_union.hpp"
 
 #include <stdexcept>
+#include <vector>
 
 namespace datasketches {
 
@@ -146,6 +147,134 @@ TEST_CASE("cpc union: moving update", "[cpc_union]") {
   REQUIRE(r.get_estimate() == Approx(100).margin(100 * RELATIVE_ERROR_FOR_LG_K_11));
 }
 
+TEST_CASE("cpc union: bulk update", "[cpc_union]") {
+  // all flavors, different lg_k and overlapping ranges of values
+  std::vector<cpc_sketch> sketches;
+  const uint8_t lg_ks[] = {10, 11, 12};
+  const uint64_t sizes[] = {0, 10, 100, 500, 2000, 10000, 50000};
+  uint64_t value = 0;
+  for (uint8_t lg_k: lg_ks) {
+    for (uint64_t n: sizes) {
+      cpc_sketch sketch(lg_k);
+      for (uint64_t i = 0; i < n; i++) sketch.update(value + i);
+      value += n / 2;
+      sketches.push_back(std::move(sketch));
+    }
+  }
+  for (unsigned num_threads: {1, 3, 8}) {
+    // one union starting with sparse accumulator, the other with bit matrix
+    for (uint64_t initial: {uint64_t(10), uint64_t(100000)}) {
+      cpc_union u1(11);
+      cpc_union u2(11);
+      cpc_sketch start(12);
+      for (uint64_t i = 0; i < initial; i++) start.update(i + 1000000);
+      u1.update(start);
+      u2.update(start);
+      for (const auto& sketch: sketches) u1.update(sketch);
+      u2.update(sketches.begin(), sketches.end(), num_threads);
+      const auto result1 = u1.get_result();
+      const auto result2 = u2.get_result();
+      REQUIRE(result2.validate());
+      REQUIRE(result2.get_lg_k() == result1.get_lg_k());
+      REQUIRE(result2.get_estimate() == result1.get_estimate());
+      REQUIRE(result2.serialize() == result1.serialize());
+    }
+  }
+}
+
+TEST_CASE("cpc union: bulk update sparse only", "[cpc_union]") {
+  std::vector<cpc_sketch> sketches;
+  for (int j = 0; j < 3; j++) {
+    cpc_sketch sketch(11);
+    for (int i = 0; i < 20; i++) sketch.update(i + j * 10);
+    sketches.push_back(std::move(sketch));
+  }
+  cpc_union u1(11);
+  for (const auto& sketch: sketches) u1.update(sketch);
+  cpc_union u2(11);
+  u2.update(sketches.begin(), sketches.end(), 4);
+  REQUIRE(u2.get_result().serialize() == u1.get_result().serialize());
+}
+
+TEST_CASE("cpc union: bulk update seed mismatch", "[cpc_union]") {
+  std::vector<cpc_sketch> sketches;
+  sketches.push_back(cpc_sketch(11, 123));
+  cpc_union u(11);
+  REQUIRE_THROWS_AS(u.update(sketches.begin(), sketches.end()), std::invalid_argument);
+}
+
+TEST_CASE("cpc union: serialized update", "[cpc_union]") {
+  // all flavors, different lg_k and overlapping ranges of values
+  std::vector<cpc_sketch> sketches;
+  const uint8_t lg_ks[] = {10, 11, 12};
+  const uint64_t sizes[] = {0, 10, 100, 500, 2000, 10000, 50000};
+  uint64_t value = 0;
+  for (uint8_t lg_k: lg_ks) {
+    for (uint64_t n: sizes) {
+      cpc_sketch sketch(lg_k);
+      for (uint64_t i = 0; i < n; i++) sketch.update(value + i);
+      value += n / 2;
+      sketches.push_back(std::move(sketch));
+    }
+  }
+  std::vector<uint8_t> all_bytes;
+  for (const auto& sketch: sketches) {
+    const auto bytes = sketch.serialize();
+    all_bytes.insert(all_bytes.end(), bytes.begin(), bytes.end());
+  }
+  // one union starting with sparse accumulator, the other with bit matrix
+  for (uint64_t initial: {uint64_t(10), uint64_t(100000)}) {
+    cpc_sketch start(12);
+    for (uint64_t i = 0; i < initial; i++) start.update(i + 1000000);
+    cpc_union u1(11);
+    u1.update(start);
+    for (const auto& sketch: sketches) u1.update(sketch);
+    const auto result1 = u1.get_result();
+
+    cpc_union u2(11);
+    u2.update(start);
+    for (const auto& sketch: sketches) {
+      const auto bytes = sketch.serialize();
+      u2.update(wrapped_cpc_sketch::wrap(bytes.data(), bytes.size()));
+    }
+    const auto result2 = u2.get_result();
+    REQUIRE(result2.validate());
+    REQUIRE(result2.serialize() == result1.serialize());
+
+    cpc_union u3(11);
+    u3.update(start);
+    u3.update_serialized(all_bytes.data(), all_bytes.size());
+    REQUIRE(u3.get_result().serialize() == result1.serialize());
+  }
+}
 
+TEST_CASE("cpc union: serialized update sparse only", "[cpc_union]") {
+  cpc_union u1(11);
+  cpc_union u2(11);
+  for (int j = 0; j < 3; j++) {
+    cpc_sketch sketch(11);
+    for (int i = 0; i < 20; i++) sketch.update(i + j * 10);
+    u1.update(sketch);
+    const auto bytes = sketch.serialize();
+    u2.update_serialized(bytes.data(), bytes.size());
+  }
+  const auto result = u2.get_result();
+  REQUIRE(result.get_num_coupons() == u1.get_result().get_num_coupons());
+  REQUIRE(result.serialize() == u1.get_result().serialize());
+}
+
+TEST_CASE("cpc union: serialized update errors", "[cpc_union]") {
+  cpc_sketch sketch(11, 123);
+  sketch.update(1);
+  auto bytes = sketch.serialize();
+  cpc_union u(11);
+  REQUIRE_THROWS_AS(u.update_serialized(bytes.data(), bytes.size()), std::invalid_argument);
+  REQUIRE_THROWS_AS(u.update(wrapped_cpc_sketch::wrap(bytes.data(), bytes.size(), 123)), std::invalid_argument);
+
+  cpc_sketch sketch2(11);
+  sketch2.update(1);
+  bytes = sketch2.serialize();
+  REQUIRE_THROWS_AS(u.update_serialized(bytes.data(), bytes.size() - 1), std::out_of_range);
+}
 
 } /* namespace datasketches */
@@ -0,0 +1,207 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Generates decompression_data.hpp from the encoding tables in compression_data.hpp.
+//
+// usage: generate_decompression_data <path>          writes the header
+//        generate_decompression_data --check <path>  fails if the header differs
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "compression_data.hpp"
+
+namespace datasketches {
+
+static const char* const HEADER =
+"/*\n"
+" * Licensed to the Apache Software Foundation (ASF) under one\n"
+" * or more contributor license agreements.  See the NOTICE file\n"
+" * distributed with this work for additional information\n"
+" * regarding copyright ownership.  The ASF licenses this file\n"
+" * to you under the Apache License, Version 2.0 (the\n"
+" * \"License\"); you may not use this file except in compliance\n"
+" * with the License.  You may obtain a copy of the License at\n"
+" *\n"
+" *   http://www.apache.org/licenses/LICENSE-2.0\n"
+" *\n"
+" * Unless required by applicable law or agreed to in writing,\n"
+" * software distributed under the License is distributed on an\n"
+" * \"AS IS\" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY\n"
+" * KIND, either express or implied.  See the License for the\n"
+" * specific language governing permissions and limitations\n"
+" * under the License.\n"
+" */\n"
+"\n"
+"#ifndef CPC_DECOMPRESSION_DATA_HPP_\n"
+"#define CPC_DECOMPRESSION_DATA_HPP_\n"
+"\n"
+"#include <cstdint>\n"
+"\n"
+"namespace datasketches {\n"
+"\n"
+"/*\n"
+"  These decoding tables are the exact inverses of the encoding tables in compression_data.hpp.\n"
+"  This file is generated by cpc/tools/generate_decompression_data.cpp, so do not edit it.\n"
+"  Build the target cpc_decompression_data to regenerate it.\n"
+"  The test cpc_decompression_data_check fails if it does not match the encoding tables.\n"
+"\n"
+"  Each decoding table has 4096 entries indexed by the next 12 bits of the stream.\n"
+"  An entry is (code_length << 8) | symbol.\n"
+"\n"
+"  The data are static members of a class template so that a program has one copy of them\n"
+"  regardless of the number of translation units that include this header.\n"
+"  The template parameter is not used.\n"
+"*/\n"
+"\n"
+"template<typename T>\n"
+"struct cpc_decoding_data {\n"
+"  static const uint16_t decoding_tables_for_high_entropy_byte[22][4096];\n"
+"  static const uint16_t length_limited_unary_decoding_table65[4096];\n"
+"  static const uint8_t column_permutations_for_decoding[16][56];\n"
+"};\n"
+"\n"
+"using decompression_data = cpc_decoding_data<void>;\n"
+"\n";
+
+static const char* const FOOTER =
+"\n"
+"} /* namespace datasketches */\n"
+"\n"
+"#endif\n";
+
+/* Given an encoding table that maps unsigned bytes to codewords
+   of length at most 12, this builds a size-4096 decoding table */
+// The second argument is typically 256, but can be other values such as 65.
+static void make_decoding_table(const uint16_t* encoding_table, unsigned num_byte_values, uint16_t* decoding_table) {
+  for (unsigned i = 0; i < 4096; i++) decoding_table[i] = 0;
+  for (unsigned byte_value = 0; byte_value < num_byte_values; byte_value++) {
+    const uint16_t encoding_entry = encoding_table[byte_value];
+    const uint16_t code_value = encoding_entry & 0xfff;
+    const uint8_t code_length = encoding_entry >> 12;
+    const uint16_t decoding_entry = static_cast<uint16_t>((code_length << 8) | byte_value);
+    const uint8_t garbage_length = 12 - code_length;
+    const uint32_t num_copies = 1 << garbage_length;
+    for (uint32_t garbage_bits = 0; garbage_bits < num_copies; garbage_bits++) {
+      const uint16_t extended_code_value = static_cast<uint16_t>(code_value | (garbage_bits << code_length));
+      decoding_table[extended_code_value & 0xfff] = decoding_entry;
+    }
+  }
+  // every entry must decode back to its own bit pattern
+  for (unsigned decode_this = 0; decode_this < 4096; decode_this++) {
+    const uint8_t decoded_byte = decoding_table[decode_this] & 0xff;
+    const uint8_t decoded_length = decoding_table[decode_this] >> 8;
+    const uint16_t encoding_entry = encoding_table[decoded_byte];
+    if (decoded_length != (encoding_entry >> 12)) throw std::logic_error("decoded length error");
+    if ((encoding_entry & 0xfff) != (decode_this & ((1u << decoded_length) - 1))) throw std::logic_error("bit pattern error");
+  }
+}
+
+static void write_decoding_table(std::ostream& os, const uint16_t* table, bool last_in_array) {
+  char buf[8];
+  for (unsigned i = 0; i < 4096; i++) {
+    if (i % 16 == 0) os << "  ";
+    std::snprintf(buf, sizeof(buf), "0x%04x", table[i]);
+    os << buf;
+    if (i == 4095) {
+      if (!last_in_array) os << ",";
+      os << "\n";
+    } else {
+      os << (i % 16 == 15 ? ",\n" : ", ");
+    }
+  }
+}
+
+static std::string generate() {
+  std::ostringstream os;
+  os << HEADER;
+  uint16_t table[4096];
+
+  os << "template<typename T>\n";
+  os << "const uint16_t cpc_decoding_data<T>::decoding_tables_for_high_entropy_byte[22][4096] = {\n";
+  for (unsigned i = 0; i < 22; i++) {
+    make_decoding_table(encoding_tables_for_high_entropy_byte[i], 256, table);
+    os << " // table " << i << " of 22\n {\n";
+    write_decoding_table(os, table, true);
+    os << (i == 21 ? " }\n" : " },\n");
+  }
+  os << "};\n\n";
+
+  os << "template<typename T>\n";
+  os << "const uint16_t cpc_decoding_data<T>::length_limited_unary_decoding_table65[4096] = {\n";
+  make_decoding_table(length_limited_unary_encoding_table65, 65, table);
+  write_decoding_table(os, table, true);
+  os << "};\n\n";
+
+  os << "template<typename T>\n";
+  os << "const uint8_t cpc_decoding_data<T>::column_permutations_for_decoding[16][56] = {\n";
+  for (unsigned i = 0; i < 16; i++) {
+    uint8_t inverse[56];
+    for (unsigned j = 0; j < 56; j++) inverse[column_permutations_for_encoding[i][j]] = static_cast<uint8_t>(j);
+    for (unsigned j = 0; j < 56; j++) {
+      if (column_permutations_for_encoding[i][inverse[j]] != j) throw std::logic_error("inverse permutation error");
+    }
+    for (unsigned j = 0; j < 56; j++) {
+      if (j == 0) os << "  {";
+      else if (j % 20 == 0) os << "   ";
+      os << static_cast<unsigned>(inverse[j]);
+      if (j == 55) os << (i == 15 ? "}\n" : "},\n");
+      else os << (j % 20 == 19 ? ",\n" : ", ");
+    }
+  }
+  os << "};\n";
+
+  os << FOOTER;
+  return os.str();
+}
+
+} /* namespace datasketches */
+
+int main(int argc, char** argv) {
+  const bool check = argc == 3 && std::strcmp(argv[1], "--check") == 0;
+  if (!check && argc != 2) {
+    std::cerr << "usage: " << argv[0] << " [--check] <path to decompression_data.hpp>" << std::endl;
+    return 2;
+  }
+  const char* path = argv[argc - 1];
+  const std::string data = datasketches::generate();
+  if (check) {
+    std::ifstream is(path, std::ios::binary);
+    std::ostringstream existing;
+    existing << is.rdbuf();
+    if (!is || existing.str() != data) {
+      std::cerr << path << " does not match the encoding tables, rebuild the target cpc_decompression_data" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+  std::ofstream os(path, std::ios::binary);
+  os << data;
+  if (!os) {
+    std::cerr << "failed to write " << path << std::endl;
+    return 1;
+  }
+  return 0;
+}
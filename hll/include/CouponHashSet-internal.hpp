@@ -256,6 +256,8 @@ static int32_t find(const uint32_t* array, uint8_t lgArrInts, uint32_t coupon) {
   const uint32_t arrMask = (1 << lgArrInts) - 1;
   uint32_t probe = coupon & arrMask;
   const uint32_t loopIndex = probe;
+  // the probe sequence is part of the serialized format, so only the stride is hoisted
+  const uint32_t stride = ((coupon & hll_constants::KEY_MASK_26) >> lgArrInts) | 1;
   do {
     const uint32_t couponAtIdx = array[probe];
     if (couponAtIdx == hll_constants::EMPTY) {
@@ -264,7 +266,6 @@ static int32_t find(const uint32_t* array, uint8_t lgArrInts, uint32_t coupon) {
     else if (coupon == couponAtIdx) {
       return probe; //duplicate
     }
-    const uint32_t stride = ((coupon & hll_constants::KEY_MASK_26) >> lgArrInts) | 1;
     probe = (probe + stride) & arrMask;
   } while (probe != loopIndex);
   throw std::invalid_argument("Key not found and no empty slots!");
@@ -27,8 +27,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <stdexcept>
 
+#if !defined(DATASKETCHES_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DATASKETCHES_SSE2
+#endif
+#ifdef DATASKETCHES_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace datasketches {
 
 template<typename A>
@@ -265,28 +273,75 @@ void CouponList<A>::serialize(std::ostream& os, const bool compact) const {
   return;
 }
 
+// coupons are not tracked individually, so a delta in LIST or SET mode
+// always carries every coupon. Applying it again is harmless.
+template<typename A>
+vector_u8<A> CouponList<A>::serializeDelta() const {
+  vector_u8<A> byteArr(hll_constants::DELTA_INT_ARR_START + couponCount_ * sizeof(uint32_t), 0, getAllocator());
+  uint8_t* bytes = byteArr.data();
+  this->writeDeltaPreamble(bytes, couponCount_);
+  bytes += hll_constants::DELTA_INT_ARR_START;
+  for (const uint32_t coupon: *this) {
+    std::memcpy(bytes, &coupon, sizeof(coupon));
+    bytes += sizeof(coupon);
+  }
+  return byteArr;
+}
+
+template<typename A>
+void CouponList<A>::checkpoint() {}
+
+namespace coupon_list_kernels {
+
+/**
+ * Checks whether the coupon is in the array without data-dependent branches.
+ * Blocks of 8 entries are compared at once: two 128-bit compares with SSE2,
+ * an unrolled scalar block otherwise. A LIST holds exactly one block.
+ */
+static inline bool contains(const uint32_t* coupons, size_t len, uint32_t coupon) {
+  size_t i = 0;
+#ifdef DATASKETCHES_SSE2
+  const __m128i key = _mm_set1_epi32(static_cast<int>(coupon));
+  __m128i found = _mm_setzero_si128();
+  for (; i + 8 <= len; i += 8) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coupons + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coupons + i + 4));
+    found = _mm_or_si128(found, _mm_or_si128(_mm_cmpeq_epi32(a, key), _mm_cmpeq_epi32(b, key)));
+  }
+  uint32_t tail = _mm_movemask_epi8(found) != 0;
+#else
+  uint32_t tail = 0;
+  for (; i + 8 <= len; i += 8) {
+    tail |= (coupons[i] == coupon) | (coupons[i + 1] == coupon) | (coupons[i + 2] == coupon) | (coupons[i + 3] == coupon)
+        | (coupons[i + 4] == coupon) | (coupons[i + 5] == coupon) | (coupons[i + 6] == coupon) | (coupons[i + 7] == coupon);
+  }
+#endif
+  for (; i < len; ++i) tail |= coupons[i] == coupon;
+  return tail != 0;
+}
+
+} // namespace coupon_list_kernels
+
 template<typename A>
 HllSketchImpl<A>* CouponList<A>::couponUpdate(uint32_t coupon) {
-  for (size_t i = 0; i < coupons_.size(); ++i) { // search for empty slot
-    const uint32_t couponAtIdx = coupons_[i];
-    if (couponAtIdx == hll_constants::EMPTY) {
-      coupons_[i] = coupon; // the actual update
-      ++couponCount_;
-      if (couponCount_ == static_cast<uint32_t>(coupons_.size())) { // array full
-        if (this->lgConfigK_ < 8) {
-          return promoteHeapListOrSetToHll(*this);
-        }
-        return promoteHeapListToSet(*this);
-      }
-      return this;
-    }
-    // cell not empty
-    if (couponAtIdx == coupon) {
-      return this; // duplicate
+  // The list is filled from the front and never has holes, so the duplicate check
+  // compares against every entry without early exit and the new coupon is appended.
+  const size_t len = coupons_.size();
+  if (coupon_list_kernels::contains(coupons_.data(), len, coupon)) {
+    return this; // duplicate
+  }
+  if (couponCount_ >= len || coupons_[couponCount_] != hll_constants::EMPTY) {
+    throw std::runtime_error("Array invalid: no empties and no duplicates");
+  }
+  coupons_[couponCount_] = coupon; // the actual update
+  ++couponCount_;
+  if (couponCount_ == static_cast<uint32_t>(len)) { // array full
+    if (this->lgConfigK_ < 8) {
+      return promoteHeapListOrSetToHll(*this);
     }
-    // cell not empty and not a duplicate, continue
+    return promoteHeapListToSet(*this);
   }
-  throw std::runtime_error("Array invalid: no empties and no duplicates");
+  return this;
 }
 
 template<typename A>
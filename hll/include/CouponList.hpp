@@ -41,6 +41,9 @@ class CouponList : public HllSketchImpl<A> {
     virtual vector_u8<A> serialize(bool compact, unsigned header_size_bytes) const;
     virtual void serialize(std::ostream& os, bool compact) const;
 
+    virtual vector_u8<A> serializeDelta() const;
+    virtual void checkpoint();
+
     virtual ~CouponList() = default;
     virtual std::function<void(HllSketchImpl<A>*)> get_deleter() const;
 
@@ -167,6 +167,7 @@ void Hll4Array<A>::internalHll4Update(uint32_t slotNo, uint8_t newVal) {
     if (newVal > actualOldValue) { // 848: actualOldValue could still be 0; newValue > 0
       // we know that the array will change, but we haven't actually updated yet
       this->hipAndKxQIncrementalUpdate(actualOldValue, newVal);
+      this->markDirty(slotNo);
 
       // newVal >= curMin
 
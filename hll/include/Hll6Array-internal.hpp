@@ -95,6 +95,7 @@ void Hll6Array<A>::internalCouponUpdate(uint32_t coupon) {
   if (newVal > curVal) {
     putSlot(slotNo, newVal);
     this->hipAndKxQIncrementalUpdate(curVal, newVal);
+    this->markDirty(slotNo);
     if (curVal == 0) {
       this->numAtCurMin_--; // interpret numAtCurMin as num zeros
     }
@@ -81,6 +81,7 @@ void Hll8Array<A>::internalCouponUpdate(uint32_t coupon) {
   if (newVal > curVal) {
     putSlot(slotNo, newVal);
     this->hipAndKxQIncrementalUpdate(curVal, newVal);
+    this->markDirty(slotNo);
     if (curVal == 0) {
       this->numAtCurMin_--; // interpret numAtCurMin as num zeros
     }
@@ -108,6 +109,7 @@ void Hll8Array<A>::mergeHll(const HllArray<A>& src) {
       if (new_v > old_v) {
         this->hllByteArr_[j] = new_v;
         this->hipAndKxQIncrementalUpdate(old_v, new_v);
+        this->markDirty(j);
         if (old_v == 0) {
           this->numAtCurMin_--;
         }
@@ -121,6 +123,7 @@ void Hll8Array<A>::mergeHll(const HllArray<A>& src) {
       if (new_v > old_v) {
         this->hllByteArr_[j] = new_v;
         this->hipAndKxQIncrementalUpdate(old_v, new_v);
+        this->markDirty(j);
         if (old_v == 0) {
           this->numAtCurMin_--;
         }
@@ -134,6 +137,7 @@ void Hll8Array<A>::mergeHll(const HllArray<A>& src) {
       if (new_v > old_v) {
         this->hllByteArr_[j] = new_v;
         this->hipAndKxQIncrementalUpdate(old_v, new_v);
+        this->markDirty(j);
         if (old_v == 0) {
           this->numAtCurMin_--;
         }
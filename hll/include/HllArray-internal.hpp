@@ -43,7 +43,8 @@ kxq1_(0.0),
 hllByteArr_(allocator),
 curMin_(0),
 numAtCurMin_(1 << lgConfigK),
-oooFlag_(false)
+oooFlag_(false),
+dirtySlots_(allocator)
 {}
 
 template<typename A>
@@ -294,6 +295,41 @@ void HllArray<A>::serialize(std::ostream& os, bool compact) const {
   }
 }
 
+// Header carries the estimator state so that a replica becomes identical
+// after applying the delta. Slots are listed as absolute values.
+// Without a checkpoint every non-zero slot is listed.
+template<typename A>
+vector_u8<A> HllArray<A>::serializeDelta() const {
+  vector_u8<A> byteArr(hll_constants::DELTA_INT_ARR_START, 0, getAllocator());
+  uint32_t count = 0;
+  for (const uint32_t coupon: *this) {
+    const uint32_t slotNo = HllUtil<A>::getLow26(coupon);
+    if (!dirtySlots_.empty() && ((dirtySlots_[slotNo >> 3] >> (slotNo & 7)) & 1) == 0) continue;
+    const size_t offset = byteArr.size();
+    byteArr.resize(offset + sizeof(coupon));
+    std::memcpy(byteArr.data() + offset, &coupon, sizeof(coupon));
+    ++count;
+  }
+  uint8_t* bytes = byteArr.data();
+  this->writeDeltaPreamble(bytes, count);
+  bytes[hll_constants::HLL_CUR_MIN_BYTE] = curMin_;
+  std::memcpy(bytes + hll_constants::HIP_ACCUM_DOUBLE, &hipAccum_, sizeof(double));
+  std::memcpy(bytes + hll_constants::KXQ0_DOUBLE, &kxq0_, sizeof(double));
+  std::memcpy(bytes + hll_constants::KXQ1_DOUBLE, &kxq1_, sizeof(double));
+  return byteArr;
+}
+
+template<typename A>
+void HllArray<A>::checkpoint() {
+  const uint32_t numBytes = (1 << this->lgConfigK_) >> 3; // lgConfigK >= 4
+  dirtySlots_.assign(numBytes, 0);
+}
+
+template<typename A>
+void HllArray<A>::markDirty(uint32_t slotNo) {
+  if (!dirtySlots_.empty()) dirtySlots_[slotNo >> 3] |= static_cast<uint8_t>(1 << (slotNo & 7));
+}
+
 template<typename A>
 double HllArray<A>::getEstimate() const {
   if (oooFlag_) {
@@ -39,6 +39,9 @@ class HllArray : public HllSketchImpl<A> {
     virtual vector_u8<A> serialize(bool compact, unsigned header_size_bytes) const;
     virtual void serialize(std::ostream& os, bool compact) const;
 
+    virtual vector_u8<A> serializeDelta() const;
+    virtual void checkpoint();
+
     virtual ~HllArray() = default;
     virtual std::function<void(HllSketchImpl<A>*)> get_deleter() const = 0;
 
@@ -98,6 +101,7 @@ class HllArray : public HllSketchImpl<A> {
 
   protected:
     void hipAndKxQIncrementalUpdate(uint8_t oldValue, uint8_t newValue);
+    inline void markDirty(uint32_t slotNo);
     double getHllBitMapEstimate() const;
     double getHllRawEstimate() const;
 
@@ -108,6 +112,7 @@ class HllArray : public HllSketchImpl<A> {
     uint8_t curMin_; //always zero for Hll6 and Hll8, only tracked by Hll4Array
     uint32_t numAtCurMin_; //interpreted as num zeros when curMin == 0
     bool oooFlag_; //Out-Of-Order Flag
+    vector_u8<A> dirtySlots_; //one bit per slot changed since the last checkpoint, empty if never checkpointed
 
     friend class HllSketchImplFactory<A>;
 };
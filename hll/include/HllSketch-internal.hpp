@@ -241,6 +241,21 @@ vector_u8<A> hll_sketch_alloc<A>::serialize_updatable() const {
   return sketch_impl->serialize(false, 0);
 }
 
+template<typename A>
+vector_u8<A> hll_sketch_alloc<A>::serialize_delta() const {
+  return sketch_impl->serializeDelta();
+}
+
+template<typename A>
+void hll_sketch_alloc<A>::checkpoint() {
+  sketch_impl->checkpoint();
+}
+
+template<typename A>
+void hll_sketch_alloc<A>::apply_delta(const void* bytes, size_t len) {
+  sketch_impl = HllSketchImplFactory<A>::applyDelta(sketch_impl, bytes, len);
+}
+
 template<typename A>
 string<A> hll_sketch_alloc<A>::to_string(const bool summary,
                                          const bool detail,
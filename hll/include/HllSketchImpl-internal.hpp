@@ -23,6 +23,7 @@
 #include "HllSketchImpl.hpp"
 #include "HllSketchImplFactory.hpp"
 
+#include <cstring>
 #include <stdexcept>
 
 namespace datasketches {
@@ -121,6 +122,17 @@ uint8_t HllSketchImpl<A>::makeModeByte() const {
   return byte;
 }
 
+template<typename A>
+void HllSketchImpl<A>::writeDeltaPreamble(uint8_t* bytes, uint32_t count) const {
+  bytes[hll_constants::PREAMBLE_INTS_BYTE] = hll_constants::DELTA_PREINTS;
+  bytes[hll_constants::SER_VER_BYTE] = hll_constants::SER_VER;
+  bytes[hll_constants::FAMILY_BYTE] = hll_constants::FAMILY_ID;
+  bytes[hll_constants::LG_K_BYTE] = lgConfigK_;
+  bytes[hll_constants::FLAGS_BYTE] = makeFlagsByte(true);
+  bytes[hll_constants::MODE_BYTE] = makeModeByte();
+  std::memcpy(bytes + hll_constants::DELTA_COUNT_INT, &count, sizeof(count));
+}
+
 template<typename A>
 HllSketchImpl<A>* HllSketchImpl<A>::reset() {
   return HllSketchImplFactory<A>::reset(this, startFullSize_);
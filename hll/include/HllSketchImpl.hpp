@@ -36,6 +36,10 @@ class HllSketchImpl {
     virtual void serialize(std::ostream& os, bool compact) const = 0;
     virtual vector_u8<A> serialize(bool compact, unsigned header_size_bytes) const = 0;
 
+    // changes since the last checkpoint, see hll_sketch_alloc::serialize_delta()
+    virtual vector_u8<A> serializeDelta() const = 0;
+    virtual void checkpoint() = 0;
+
     virtual HllSketchImpl* copy() const = 0;
     virtual HllSketchImpl* copyAs(target_hll_type tgtHllType) const = 0;
     HllSketchImpl<A>* reset();
@@ -74,6 +78,7 @@ class HllSketchImpl {
     static hll_mode extractCurMode(uint8_t modeByte);
     uint8_t makeFlagsByte(bool compact) const;
     uint8_t makeModeByte() const;
+    void writeDeltaPreamble(uint8_t* bytes, uint32_t count) const;
 
     const uint8_t lgConfigK_;
     const target_hll_type tgtHllType_;
@@ -20,7 +20,9 @@
 #ifndef _HLLSKETCHIMPLFACTORY_HPP_
 #define _HLLSKETCHIMPLFACTORY_HPP_
 
+#include <cstring>
 #include <stdexcept>
+#include <string>
 
 #include "HllUtil.hpp"
 #include "HllSketchImpl.hpp"
@@ -46,6 +48,11 @@ public:
   // resets the input impl, deleting the input pointer and returning a new pointer
   static HllSketchImpl<A>* reset(HllSketchImpl<A>* impl, bool startFullSize);
 
+  // validates a delta image and returns the mode of the sketch that produced it
+  static hll_mode checkDelta(const void* bytes, size_t len);
+  // applies a delta to the input impl, deleting the input pointer if a new one is returned
+  static HllSketchImpl<A>* applyDelta(HllSketchImpl<A>* impl, const void* bytes, size_t len);
+
   static Hll4Array<A>* convertToHll4(const HllArray<A>& srcHllArr);
   static Hll6Array<A>* convertToHll6(const HllArray<A>& srcHllArr);
   static Hll8Array<A>* convertToHll8(const HllArray<A>& srcHllArr);
@@ -134,6 +141,79 @@ HllSketchImpl<A>* HllSketchImplFactory<A>::reset(HllSketchImpl<A>* impl, bool st
   }
 }
 
+template<typename A>
+hll_mode HllSketchImplFactory<A>::checkDelta(const void* bytes, size_t len) {
+  if (len < hll_constants::DELTA_INT_ARR_START) {
+    throw std::out_of_range("Input data length insufficient to hold HLL delta");
+  }
+  const uint8_t* data = static_cast<const uint8_t*>(bytes);
+  if (data[hll_constants::PREAMBLE_INTS_BYTE] != hll_constants::DELTA_PREINTS) {
+    throw std::invalid_argument("Incorrect number of preInts in HLL delta");
+  }
+  if (data[hll_constants::SER_VER_BYTE] != hll_constants::SER_VER) {
+    throw std::invalid_argument("Wrong ser ver in HLL delta");
+  }
+  if (data[hll_constants::FAMILY_BYTE] != hll_constants::FAMILY_ID) {
+    throw std::invalid_argument("Input array is not an HLL delta");
+  }
+  HllUtil<A>::checkLgK(data[hll_constants::LG_K_BYTE]);
+  uint32_t count;
+  std::memcpy(&count, data + hll_constants::DELTA_COUNT_INT, sizeof(count));
+  if (len < hll_constants::DELTA_INT_ARR_START + static_cast<size_t>(count) * sizeof(uint32_t)) {
+    throw std::out_of_range("Input array too small to hold HLL delta");
+  }
+  return HllArray<A>::extractCurMode(data[hll_constants::MODE_BYTE]);
+}
+
+template<typename A>
+HllSketchImpl<A>* HllSketchImplFactory<A>::applyDelta(HllSketchImpl<A>* impl, const void* bytes, size_t len) {
+  const hll_mode mode = checkDelta(bytes, len);
+  const uint8_t* data = static_cast<const uint8_t*>(bytes);
+  if (data[hll_constants::LG_K_BYTE] != impl->getLgConfigK()) {
+    throw std::invalid_argument("Delta lg_k " + std::to_string(data[hll_constants::LG_K_BYTE])
+        + " does not match sketch lg_k " + std::to_string(impl->getLgConfigK()));
+  }
+  uint32_t count;
+  std::memcpy(&count, data + hll_constants::DELTA_COUNT_INT, sizeof(count));
+  const uint8_t* coupons = data + hll_constants::DELTA_INT_ARR_START;
+
+  if (mode != HLL) {
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t coupon;
+      std::memcpy(&coupon, coupons + i * sizeof(coupon), sizeof(coupon));
+      HllSketchImpl<A>* result = impl->couponUpdate(coupon);
+      if (result != impl) {
+        impl->get_deleter()(impl);
+        impl = result;
+      }
+    }
+    return impl;
+  }
+
+  // the source went to HLL mode after the last checkpoint, so the delta lists every slot
+  if (impl->getCurMode() != HLL) {
+    HllArray<A>* hll = newHll(impl->getLgConfigK(), impl->getTgtHllType(), false, impl->getAllocator());
+    impl->get_deleter()(impl);
+    impl = hll;
+  }
+  HllArray<A>* hll = static_cast<HllArray<A>*>(impl);
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t coupon;
+    std::memcpy(&coupon, coupons + i * sizeof(coupon), sizeof(coupon));
+    hll->couponUpdate(coupon);
+  }
+  // estimator state of the source replaces the incremental updates above
+  double hip, kxq0, kxq1;
+  std::memcpy(&hip, data + hll_constants::HIP_ACCUM_DOUBLE, sizeof(double));
+  std::memcpy(&kxq0, data + hll_constants::KXQ0_DOUBLE, sizeof(double));
+  std::memcpy(&kxq1, data + hll_constants::KXQ1_DOUBLE, sizeof(double));
+  hll->putOutOfOrderFlag((data[hll_constants::FLAGS_BYTE] & hll_constants::OUT_OF_ORDER_FLAG_MASK) != 0);
+  hll->putHipAccum(hip);
+  hll->putKxQ0(kxq0);
+  hll->putKxQ1(kxq1);
+  return hll;
+}
+
 template<typename A>
 Hll4Array<A>* HllSketchImplFactory<A>::convertToHll4(const HllArray<A>& srcHllArr) {
   const uint8_t lgConfigK = srcHllArr.getLgConfigK();
@@ -25,9 +25,15 @@
 #include "HllSketchImpl.hpp"
 #include "HllArray.hpp"
 #include "HllUtil.hpp"
+#include "HllSketchImplFactory.hpp"
+#include "inv_pow2_table.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace datasketches {
 
@@ -59,6 +65,194 @@ void hll_union_alloc<A>::update(hll_sketch_alloc<A>&& sketch) {
   union_impl(sketch, lg_max_k_);
 }
 
+template<typename A>
+template<typename InputIt>
+void hll_union_alloc<A>::update(InputIt first, InputIt last, unsigned num_threads) {
+  using AllocSketchPtr = typename std::allocator_traits<A>::template rebind_alloc<const hll_sketch_alloc<A>*>;
+  using AllocHllPtr = typename std::allocator_traits<A>::template rebind_alloc<const HllArray<A>*>;
+  const A allocator = gadget_.sketch_impl->getAllocator();
+  std::vector<const hll_sketch_alloc<A>*, AllocSketchPtr> sketches(allocator);
+  std::vector<const HllArray<A>*, AllocHllPtr> hll_arrays(allocator);
+  uint8_t tgt_lg_k = gadget_.get_lg_config_k();
+  for (; first != last; ++first) {
+    const hll_sketch_alloc<A>& sketch = *first;
+    if (sketch.is_empty()) continue;
+    sketches.push_back(&sketch);
+    if (sketch.get_current_mode() == HLL) {
+      hll_arrays.push_back(static_cast<const HllArray<A>*>(sketch.sketch_impl));
+      tgt_lg_k = std::min(tgt_lg_k, sketch.get_lg_config_k());
+    }
+  }
+
+  // With fewer than two sketches in HLL mode the HIP estimate may survive, and it depends on order.
+  // A gadget in LIST or SET mode with reduced K (after a reset) may or may not promote itself
+  // before the first sketch in HLL mode arrives, which changes the resulting K.
+  // Both cases are merged serially.
+  if (hll_arrays.size() < 2 || (gadget_.get_current_mode() != HLL && gadget_.get_lg_config_k() != lg_max_k_)) {
+    for (const auto sketch: sketches) union_impl(*sketch, lg_max_k_);
+    return;
+  }
+
+  // After the second sketch in HLL mode the serial union is out of order with no HIP estimate,
+  // and its registers are the maximum over all inputs regardless of order.
+  HllSketchImpl<A>* dst_impl = gadget_.sketch_impl;
+  const CouponList<A>* gadget_coupons = nullptr;
+  if (dst_impl->getCurMode() == HLL) {
+    if (dst_impl->getLgConfigK() > tgt_lg_k) {
+      dst_impl = copy_or_downsample(dst_impl, tgt_lg_k);
+    }
+  } else {
+    typedef typename std::allocator_traits<A>::template rebind_alloc<Hll8Array<A>> hll8Alloc;
+    dst_impl = new (hll8Alloc(allocator).allocate(1)) Hll8Array<A>(tgt_lg_k, false, allocator);
+    gadget_coupons = static_cast<const CouponList<A>*>(gadget_.sketch_impl);
+  }
+  Hll8Array<A>* dst = static_cast<Hll8Array<A>*>(dst_impl);
+  dst->putOutOfOrderFlag(true);
+  dst->putHipAccum(0);
+
+  const uint32_t k = 1 << tgt_lg_k;
+  num_threads = std::max(1U, std::min(num_threads, k));
+  using AllocStats = typename std::allocator_traits<A>::template rebind_alloc<slice_stats>;
+  std::vector<slice_stats, AllocStats> stats(num_threads, slice_stats(), allocator);
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (unsigned i = 1; i < num_threads; ++i) {
+    threads.emplace_back([&, i]() {
+      stats[i] = merge_slice(dst, hll_arrays.data(), hll_arrays.size(),
+          static_cast<uint32_t>(static_cast<uint64_t>(k) * i / num_threads),
+          static_cast<uint32_t>(static_cast<uint64_t>(k) * (i + 1) / num_threads));
+    });
+  }
+  stats[0] = merge_slice(dst, hll_arrays.data(), hll_arrays.size(), 0, k / num_threads);
+  for (auto& thread: threads) thread.join();
+
+  // all terms are powers of 2 within the precision of a double, so the order of summation does not matter
+  double kxq0 = dst->getKxQ0();
+  double kxq1 = dst->getKxQ1();
+  uint32_t num_zeros = dst->getNumAtCurMin();
+  for (const auto& slice: stats) {
+    kxq0 += slice.kxq0;
+    kxq1 += slice.kxq1;
+    num_zeros -= slice.num_zeros;
+  }
+  dst->putKxQ0(kxq0);
+  dst->putKxQ1(kxq1);
+  dst->putNumAtCurMin(num_zeros);
+
+  if (gadget_coupons != nullptr) dst->mergeList(*gadget_coupons);
+  for (const auto sketch: sketches) {
+    if (sketch->get_current_mode() != HLL) {
+      dst->mergeList(*static_cast<const CouponList<A>*>(sketch->sketch_impl));
+    }
+  }
+
+  if (dst_impl != gadget_.sketch_impl) {
+    gadget_.sketch_impl->get_deleter()(gadget_.sketch_impl); // gadget to be replaced
+    gadget_.sketch_impl = dst_impl; // gadget replaced
+  }
+}
+
+template<typename A>
+typename hll_union_alloc<A>::slice_stats hll_union_alloc<A>::get_slice_stats(const Hll8Array<A>& hll, uint32_t begin, uint32_t end) {
+  slice_stats stats = {0, 0, 0};
+  for (uint32_t i = begin; i < end; ++i) {
+    const uint8_t value = hll.getSlot(i);
+    if (value < 32) { stats.kxq0 += INVERSE_POWERS_OF_2[value]; }
+    else            { stats.kxq1 += INVERSE_POWERS_OF_2[value]; }
+    if (value == 0) ++stats.num_zeros;
+  }
+  return stats;
+}
+
+template<typename A>
+typename hll_union_alloc<A>::slice_stats hll_union_alloc<A>::merge_slice(Hll8Array<A>* dst, const HllArray<A>* const* srcs,
+    size_t num_srcs, uint32_t begin, uint32_t end) {
+  const slice_stats before = get_slice_stats(*dst, begin, end);
+  const uint8_t dst_lg_k = dst->getLgConfigK();
+  // duplication below is to avoid a virtual method call in a loop
+  for (size_t s = 0; s < num_srcs; ++s) {
+    const HllArray<A>& src = *srcs[s];
+    // source slots that map to slot j of the destination are j + t * dst_k
+    const uint32_t num_folds = 1 << (src.getLgConfigK() - dst_lg_k);
+    for (uint32_t t = 0; t < num_folds; ++t) {
+      const uint32_t offset = t << dst_lg_k;
+      if (src.getTgtHllType() == target_hll_type::HLL_8) {
+        const Hll8Array<A>& src8 = static_cast<const Hll8Array<A>&>(src);
+        for (uint32_t j = begin; j < end; ++j) {
+          const uint8_t new_v = src8.getSlot(offset + j);
+          if (new_v > dst->getSlot(j)) dst->putSlot(j, new_v);
+        }
+      } else if (src.getTgtHllType() == target_hll_type::HLL_6) {
+        const Hll6Array<A>& src6 = static_cast<const Hll6Array<A>&>(src);
+        for (uint32_t j = begin; j < end; ++j) {
+          const uint8_t new_v = src6.getSlot(offset + j);
+          if (new_v > dst->getSlot(j)) dst->putSlot(j, new_v);
+        }
+      } else { // HLL_4
+        const Hll4Array<A>& src4 = static_cast<const Hll4Array<A>&>(src);
+        for (uint32_t j = begin; j < end; ++j) {
+          const uint8_t new_v = src4.get_value(offset + j);
+          if (new_v > dst->getSlot(j)) dst->putSlot(j, new_v);
+        }
+      }
+    }
+  }
+  const slice_stats after = get_slice_stats(*dst, begin, end);
+  return slice_stats {after.kxq0 - before.kxq0, after.kxq1 - before.kxq1, before.num_zeros - after.num_zeros};
+}
+
+template<typename A>
+void hll_union_alloc<A>::apply_delta(const void* bytes, size_t len) {
+  const hll_mode mode = HllSketchImplFactory<A>::checkDelta(bytes, len);
+  const uint8_t* data = static_cast<const uint8_t*>(bytes);
+  const uint8_t src_lg_k = data[hll_constants::LG_K_BYTE];
+  uint32_t count;
+  std::memcpy(&count, data + hll_constants::DELTA_COUNT_INT, sizeof(count));
+  const uint8_t* coupons = data + hll_constants::DELTA_INT_ARR_START;
+
+  HllSketchImpl<A>* dst_impl = gadget_.sketch_impl;
+  if (mode == LIST || mode == SET) {
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t coupon;
+      std::memcpy(&coupon, coupons + i * sizeof(coupon), sizeof(coupon));
+      dst_impl = leak_free_coupon_update(dst_impl, coupon); //assignment required
+    }
+  } else if (dst_impl->getCurMode() == HLL) {
+    // same as merging the whole source since slots that did not change were merged before
+    if (src_lg_k < dst_impl->getLgConfigK()) {
+      dst_impl = copy_or_downsample(dst_impl, src_lg_k);
+      gadget_.sketch_impl->get_deleter()(gadget_.sketch_impl); // gadget to be replaced
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t coupon;
+      std::memcpy(&coupon, coupons + i * sizeof(coupon), sizeof(coupon));
+      dst_impl->couponUpdate(coupon);
+    }
+    dst_impl->putOutOfOrderFlag(true);
+    static_cast<Hll8Array<A>*>(dst_impl)->putHipAccum(0);
+  } else {
+    // the source went to HLL mode after its last checkpoint, so the delta lists every slot
+    const uint8_t tgt_lg_k = std::min(src_lg_k, lg_max_k_);
+    typedef typename std::allocator_traits<A>::template rebind_alloc<Hll8Array<A>> hll8Alloc;
+    Hll8Array<A>* tgtHllArr = new (hll8Alloc(dst_impl->getAllocator()).allocate(1)) Hll8Array<A>(tgt_lg_k, false, dst_impl->getAllocator());
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t coupon;
+      std::memcpy(&coupon, coupons + i * sizeof(coupon), sizeof(coupon));
+      tgtHllArr->couponUpdate(coupon);
+    }
+    double hip;
+    std::memcpy(&hip, data + hll_constants::HIP_ACCUM_DOUBLE, sizeof(double));
+    tgtHllArr->putHipAccum(hip);
+    tgtHllArr->putOutOfOrderFlag((data[hll_constants::FLAGS_BYTE] & hll_constants::OUT_OF_ORDER_FLAG_MASK) != 0);
+    if (!dst_impl->isEmpty()) {
+      tgtHllArr->mergeList(*static_cast<const CouponList<A>*>(dst_impl));
+    }
+    dst_impl->get_deleter()(dst_impl); // gadget to be replaced
+    dst_impl = tgtHllArr;
+  }
+  gadget_.sketch_impl = dst_impl; // gadget replaced
+}
+
 template<typename A>
 void hll_union_alloc<A>::update(const std::string& datum) {
   gadget_.update(datum);
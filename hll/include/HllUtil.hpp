@@ -70,6 +70,10 @@ static const uint32_t KXQ0_DOUBLE = 16;
 static const uint32_t KXQ1_DOUBLE = 24;
 static const uint32_t CUR_MIN_COUNT_INT = 32;
 static const uint32_t AUX_COUNT_INT = 36;
+// Delta (changes since the last checkpoint)
+static const uint8_t DELTA_PREINTS = 9;
+static const uint32_t DELTA_COUNT_INT = 32;
+static const uint32_t DELTA_INT_ARR_START = 36;
 
 static const uint32_t EMPTY_SKETCH_SIZE_BYTES = 8;
 
@@ -57,6 +57,17 @@ namespace datasketches {
  * to and from off-heap memory-mapped files, for example, and eliminates big garbage collection
  * delays.
  *
+ * <p>All memory is obtained from the allocator given as the template parameter A.
+ * The following paths allocate: construction (the initial coupon list), promotion from LIST
+ * to SET, growth of the SET, promotion to HLL, the auxiliary exception map of HLL_4 (created,
+ * grown and rebuilt when the minimum register value increases), copies and conversions to another
+ * target type, deserialization, serialization (the returned byte vector), reset, and in the union
+ * get_result(), downsampling of the internal sketch, apply_delta() and the bulk update.
+ * Every path returns memory through the same allocator, but none of them relies on
+ * deallocate() for memory to be reused. Therefore a monotonic allocator such as
+ * arena_allocator (see arena_allocator.hpp) can be used for many short-lived sketches,
+ * with the arena reset once all of them are destroyed.
+ *
  * author Jon Malkin
  * author Lee Rhodes
  * author Kevin Lang
@@ -102,6 +113,12 @@ enum target_hll_type {
 template<typename A>
 class HllSketchImpl;
 
+template<typename A>
+class HllArray;
+
+template<typename A>
+class Hll8Array;
+
 template<typename A>
 class hll_union_alloc;
 
@@ -193,6 +210,33 @@ class hll_sketch_alloc final {
      */
     void serialize_updatable(std::ostream& os) const;
 
+    /**
+     * Serializes the changes made to the sketch since the last call to checkpoint().
+     * In HLL mode the image lists the (slot, value) pairs that changed, so its size
+     * scales with the number of changed slots rather than with K. Before the first
+     * checkpoint in HLL mode, and in LIST or SET mode, all non-empty entries are listed.
+     * The image is not a sketch and can only be consumed by apply_delta().
+     * @return byte array with the delta image
+     */
+    vector_bytes serialize_delta() const;
+
+    /**
+     * Marks the current state as the base for the next serialize_delta().
+     * In HLL mode this starts change tracking, which costs one bit per slot.
+     */
+    void checkpoint();
+
+    /**
+     * Applies a delta image produced by serialize_delta() of another sketch.
+     * The receiving sketch must have the same lg_config_k and must hold the state
+     * of the source as of the checkpoint the delta was taken against
+     * (for instance, by applying all previous deltas in order).
+     * The target type may differ from that of the source.
+     * @param bytes delta image
+     * @param len length of the image in bytes
+     */
+    void apply_delta(const void* bytes, size_t len);
+
     /**
      * Human readable summary with optional detail
      * @param summary if true, output the sketch summary
@@ -511,6 +555,28 @@ class hll_union_alloc {
      * @param The given sketch.
      */
     void update(hll_sketch_alloc<A>&& sketch);
+
+    /**
+     * Update this union operator with a range of sketches.
+     * The result is identical to updating with each sketch of the range in turn.
+     * Sketches in HLL mode are merged in one pass over the registers of the union,
+     * which is split into num_threads slices, each merged by its own thread taking the
+     * maximum over all inputs. Sketches in LIST or SET mode are merged afterwards.
+     * @param first iterator to the first sketch
+     * @param last iterator past the last sketch
+     * @param num_threads number of threads to use (the calling thread is one of them)
+     */
+    template<typename InputIt>
+    void update(InputIt first, InputIt last, unsigned num_threads = 1);
+
+    /**
+     * Update this union operator with a delta image produced by
+     * hll_sketch_alloc::serialize_delta(). Applying the deltas of a source
+     * in order is equivalent to updating with the source sketch itself.
+     * @param bytes delta image
+     * @param len length of the image in bytes
+     */
+    void apply_delta(const void* bytes, size_t len);
   
     /**
      * Present the given std::string as a potential unique item.
@@ -615,6 +681,18 @@ class hll_union_alloc {
 
     static HllSketchImpl<A>* copy_or_downsample(const HllSketchImpl<A>* src_impl, uint8_t tgt_lg_k);
 
+    // kxq sums and number of zeros over a slice of registers
+    struct slice_stats {
+      double kxq0;
+      double kxq1;
+      uint32_t num_zeros;
+    };
+    static slice_stats get_slice_stats(const Hll8Array<A>& hll, uint32_t begin, uint32_t end);
+
+    // merges the given HLL arrays into slots [begin, end) of dst and returns the change of kxq sums and zeros
+    static slice_stats merge_slice(Hll8Array<A>* dst, const HllArray<A>* const* srcs, size_t num_srcs,
+        uint32_t begin, uint32_t end);
+
     void coupon_update(uint32_t coupon);
 
     hll_mode get_current_mode() const;
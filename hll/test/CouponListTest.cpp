@@ -24,9 +24,14 @@
 #include <string>
 #include <exception>
 #include <stdexcept>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
 
 #include "hll.hpp"
 #include "CouponList.hpp"
+#include "CouponHashSet.hpp"
 #include "HllUtil.hpp"
 
 namespace datasketches {
@@ -180,4 +185,52 @@ TEST_CASE("coupon list: check corrupt stream data", "[coupon_list]") {
   REQUIRE_THROWS_AS(hll_sketch::deserialize(ss), std::invalid_argument);
 }
 
+// not run by default: ./hll_test "[benchmark]"
+TEST_CASE("coupon list: benchmark duplicate check", "[.][benchmark]") {
+  const size_t num_lookups = 1 << 24;
+  std::mt19937 gen(1);
+  std::vector<uint32_t> probes(1 << 12);
+  const size_t mask = probes.size() - 1;
+
+  for (size_t len: {8, 16, 32, 64}) {
+    std::vector<uint32_t> coupons(len);
+    for (size_t i = 0; i < len; ++i) coupons[i] = HllUtil<>::pair(static_cast<uint32_t>(i + 1), 1);
+    for (auto& p: probes) p = HllUtil<>::pair(static_cast<uint32_t>(gen() % (2 * len) + 1), 1); // half are duplicates
+
+    // the loop used before the fixed-width kernel
+    auto start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (size_t i = 0; i < num_lookups; ++i) {
+      const uint32_t coupon = probes[i & mask];
+      for (size_t j = 0; j < len; ++j) {
+        if (coupons[j] == coupon) { ++found; break; }
+      }
+    }
+    const double early_exit_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / num_lookups;
+
+    start = std::chrono::steady_clock::now();
+    size_t found_kernel = 0;
+    for (size_t i = 0; i < num_lookups; ++i) {
+      found_kernel += coupon_list_kernels::contains(coupons.data(), len, probes[i & mask]);
+    }
+    const double kernel_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / num_lookups;
+    REQUIRE(found == found_kernel);
+
+    // the same coupons in the open-addressed table of a SET, which is what the LIST is promoted to
+    const uint8_t lg_set_size = count_trailing_zeros_in_u32(static_cast<uint32_t>(len)) + 1; // below the 3/4 load limit
+    std::vector<uint32_t> set(1 << lg_set_size, hll_constants::EMPTY);
+    for (size_t i = 0; i < len; ++i) set[~find<std::allocator<uint8_t>>(set.data(), lg_set_size, coupons[i])] = coupons[i];
+    start = std::chrono::steady_clock::now();
+    size_t found_set = 0;
+    for (size_t i = 0; i < num_lookups; ++i) {
+      found_set += find<std::allocator<uint8_t>>(set.data(), lg_set_size, probes[i & mask]) >= 0;
+    }
+    const double set_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / num_lookups;
+    REQUIRE(found == found_set);
+
+    std::cout << "coupons: " << len << ", early exit: " << early_exit_ns << " ns, kernel: " << kernel_ns
+        << " ns, set: " << set_ns << " ns per lookup" << std::endl;
+  }
+}
+
 } /* namespace datasketches */
@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements.  See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership.  The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied.  See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+#include <catch2/catch.hpp>
+#include <sstream>
+
+#include "hll.hpp"
+#include "arena_allocator.hpp"
+
+namespace datasketches {
+
+using arena_alloc = arena_allocator<uint8_t>;
+using hll_sketch_arena = hll_sketch_alloc<arena_alloc>;
+using hll_union_arena = hll_union_alloc<arena_alloc>;
+
+static const target_hll_type types[3] = {HLL_4, HLL_6, HLL_8};
+
+// one aggregation window: short-lived sketches through all modes, merged into a union
+static double run_window(monotonic_arena& arena, uint64_t base, target_hll_type type) {
+  arena_alloc alloc(arena);
+  hll_union_arena u(12, alloc);
+  for (int s = 0; s < 4; ++s) {
+    // LIST, SET and HLL modes plus a different lg_k to force downsampling
+    const uint8_t lg_k = s == 3 ? 13 : 11;
+    const uint64_t n = s == 0 ? 5 : s == 1 ? 200 : 20000;
+    hll_sketch_arena sk(lg_k, type, false, alloc);
+    for (uint64_t i = 0; i < n; ++i) sk.update(base + s * 100000 + i);
+    u.update(sk);
+  }
+  auto result = u.get_result(type);
+  auto bytes = result.serialize_updatable();
+  auto copy = hll_sketch_arena::deserialize(bytes.data(), bytes.size(), alloc);
+  REQUIRE(copy.get_estimate() == result.get_estimate());
+  std::stringstream ss;
+  result.serialize_compact(ss);
+  auto copy2 = hll_sketch_arena::deserialize(ss, alloc);
+  REQUIRE(copy2.get_estimate() == result.get_estimate());
+  return result.get_estimate();
+}
+
+TEST_CASE("hll arena: matches default allocator", "[hll_arena]") {
+  for (auto type: types) {
+    monotonic_arena arena;
+    hll_sketch_arena sk_arena(10, type, false, arena_alloc(arena));
+    hll_sketch sk_std(10, type);
+    for (int i = 0; i < 10000; ++i) {
+      sk_arena.update(i);
+      sk_std.update(i);
+      if (i % 997 == 0) REQUIRE(sk_arena.get_estimate() == sk_std.get_estimate());
+    }
+    REQUIRE(sk_arena.get_estimate() == sk_std.get_estimate());
+    auto bytes = sk_arena.serialize_compact();
+    auto bytes_std = sk_std.serialize_compact();
+    REQUIRE(std::vector<uint8_t>(bytes.begin(), bytes.end()) == bytes_std);
+  }
+}
+
+TEST_CASE("hll arena: reset between windows", "[hll_arena]") {
+  for (auto type: types) {
+    monotonic_arena arena;
+    const double estimate = run_window(arena, 0, type);
+    REQUIRE(arena.get_allocated_bytes() > 0);
+    arena.reset();
+    const size_t reserved = arena.get_reserved_bytes();
+    for (int w = 0; w < 5; ++w) {
+      // the same workload must fit into the memory reserved by the first window
+      REQUIRE(run_window(arena, 0, type) == estimate);
+      REQUIRE(arena.get_reserved_bytes() == reserved);
+      arena.reset();
+    }
+  }
+}
+
+} /* namespace datasketches */
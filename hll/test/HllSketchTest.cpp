@@ -441,4 +441,54 @@ TEST_CASE("hll sketch: compact bytes serialize-deserialize-serialize set mode")
   REQUIRE(test_allocator_total_bytes == 0);
 }
 
+TEST_CASE("hll sketch: delta in hll mode", "[hll_sketch]") {
+  for (target_hll_type type: {HLL_4, HLL_6, HLL_8}) {
+    hll_sketch source(14, type);
+    for (int i = 0; i < 100000; ++i) source.update(i);
+    auto full = source.serialize_compact();
+    auto replica = hll_sketch::deserialize(full.data(), full.size());
+
+    source.checkpoint();
+    REQUIRE(source.serialize_delta().size() == hll_constants::DELTA_INT_ARR_START);
+    for (int i = 100000; i < 100050; ++i) source.update(i);
+    auto delta = source.serialize_delta();
+    REQUIRE(delta.size() < full.size() / 10);
+
+    replica.apply_delta(delta.data(), delta.size());
+    REQUIRE(replica.get_estimate() == source.get_estimate());
+    REQUIRE(replica.get_composite_estimate() == source.get_composite_estimate());
+    REQUIRE(replica.get_lower_bound(1) == source.get_lower_bound(1));
+    REQUIRE(replica.get_upper_bound(1) == source.get_upper_bound(1));
+    if (type != HLL_4) { // aux map layout may differ for HLL_4
+      REQUIRE(replica.serialize_compact() == source.serialize_compact());
+    }
+  }
+}
+
+TEST_CASE("hll sketch: delta through mode transitions", "[hll_sketch]") {
+  hll_sketch source(10, HLL_4);
+  hll_sketch replica(10, HLL_8);
+  int value = 0;
+  for (int step = 0; step < 20; ++step) {
+    for (int i = 0; i < 20 * step; ++i) source.update(value++);
+    auto delta = source.serialize_delta();
+    source.checkpoint();
+    replica.apply_delta(delta.data(), delta.size());
+    REQUIRE(replica.get_estimate() == source.get_estimate());
+    REQUIRE(replica.get_lower_bound(2) == source.get_lower_bound(2));
+  }
+}
+
+TEST_CASE("hll sketch: delta invalid input", "[hll_sketch]") {
+  hll_sketch source(10);
+  source.update(1);
+  auto delta = source.serialize_delta();
+  hll_sketch other(11);
+  REQUIRE_THROWS_AS(other.apply_delta(delta.data(), delta.size()), std::invalid_argument);
+  REQUIRE_THROWS_AS(other.apply_delta(delta.data(), delta.size() - 1), std::out_of_range);
+  REQUIRE_THROWS_AS(hll_sketch::deserialize(delta.data(), delta.size()), std::invalid_argument);
+  auto image = source.serialize_compact();
+  REQUIRE_THROWS(source.apply_delta(image.data(), image.size()));
+}
+
 } /* namespace datasketches */
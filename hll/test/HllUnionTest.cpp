@@ -20,6 +20,7 @@
 #include <catch2/catch.hpp>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 #include "hll.hpp"
 
@@ -308,4 +309,81 @@ TEST_CASE("hll union: check hll to hll", "[hll_union]") {
   union_two_sketches_with_overlap(1000000, 11, HLL_4);
 }
 
+TEST_CASE("hll union: apply deltas", "[hll_union]") {
+  for (uint8_t lg_max_k: {10, 12, 14}) {
+    hll_sketch source1(12, HLL_4);
+    hll_sketch source2(13, HLL_6);
+    hll_union u_full(lg_max_k);
+    hll_union u_delta(lg_max_k);
+    int value = 0;
+    for (int step = 0; step < 12; ++step) {
+      const int n = 1 << step;
+      for (int i = 0; i < n; ++i) source1.update(value++);
+      for (int i = 0; i < n; ++i) source2.update(value++);
+      auto delta1 = source1.serialize_delta();
+      source1.checkpoint();
+      u_delta.apply_delta(delta1.data(), delta1.size());
+      auto delta2 = source2.serialize_delta();
+      source2.checkpoint();
+      u_delta.apply_delta(delta2.data(), delta2.size());
+    }
+    u_full.update(source1);
+    u_full.update(source2);
+    REQUIRE(u_delta.get_lg_config_k() == u_full.get_lg_config_k());
+    REQUIRE(u_delta.get_composite_estimate() == u_full.get_composite_estimate());
+    REQUIRE(u_delta.get_result(HLL_8).serialize_compact() == u_full.get_result(HLL_8).serialize_compact());
+  }
+}
+
+TEST_CASE("hll union: bulk update matches serial", "[hll_union]") {
+  const target_hll_type types[] = {HLL_4, HLL_6, HLL_8};
+  std::vector<hll_sketch> sketches;
+  uint64_t value = 0;
+  for (int i = 0; i < 30; ++i) {
+    const uint8_t lg_k = 8 + i % 5;
+    hll_sketch sketch(lg_k, types[i % 3]);
+    // mix of empty, LIST, SET and HLL modes
+    const uint64_t n = (i % 4 == 0) ? 0 : (i % 4 == 1) ? 5 : (i % 4 == 2) ? 20 : 10000 + i * 100;
+    for (uint64_t j = 0; j < n; ++j) sketch.update(value++);
+    value -= n / 2; // overlap with the next sketch
+    sketches.push_back(std::move(sketch));
+  }
+
+  for (unsigned num_threads: {1, 3, 8}) {
+    for (uint8_t lg_max_k: {9, 12}) {
+      for (size_t num_sketches: {static_cast<size_t>(2), static_cast<size_t>(4), sketches.size()}) {
+        hll_union u_serial(lg_max_k);
+        u_serial.update(static_cast<uint64_t>(1000000));
+        for (size_t i = 0; i < num_sketches; ++i) u_serial.update(sketches[i]);
+        hll_union u_bulk(lg_max_k);
+        u_bulk.update(static_cast<uint64_t>(1000000));
+        u_bulk.update(sketches.begin(), sketches.begin() + num_sketches, num_threads);
+        REQUIRE(u_bulk.get_lg_config_k() == u_serial.get_lg_config_k());
+        REQUIRE(u_bulk.get_estimate() == u_serial.get_estimate());
+        REQUIRE(u_bulk.get_composite_estimate() == u_serial.get_composite_estimate());
+        REQUIRE(u_bulk.get_result(HLL_8).serialize_compact() == u_serial.get_result(HLL_8).serialize_compact());
+      }
+    }
+  }
+}
+
+TEST_CASE("hll union: bulk update into hll gadget", "[hll_union]") {
+  std::vector<hll_sketch> sketches;
+  for (int i = 0; i < 8; ++i) {
+    hll_sketch sketch(11, HLL_4);
+    for (int j = 0; j < 50000; ++j) sketch.update(i * 10000 + j);
+    sketches.push_back(std::move(sketch));
+  }
+  hll_union u_serial(12);
+  hll_union u_bulk(12);
+  for (int j = 0; j < 100000; ++j) {
+    u_serial.update(j);
+    u_bulk.update(j);
+  }
+  for (const auto& sketch: sketches) u_serial.update(sketch);
+  u_bulk.update(sketches.begin(), sketches.end(), 4);
+  REQUIRE(u_bulk.get_lg_config_k() == 11);
+  REQUIRE(u_bulk.get_result(HLL_8).serialize_compact() == u_serial.get_result(HLL_8).serialize_compact());
+}
+
 } /* namespace datasketches */
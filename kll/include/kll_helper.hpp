@@ -22,6 +22,10 @@
 
 #include <random>
 #include <stdexcept>
+#include <type_traits>
+
+#include "compaction_kernels.hpp"
+#include "sort_utils.hpp"
 
 namespace datasketches {
 
@@ -63,9 +67,9 @@ class kll_helper {
     // this version is to merge from two different buffers into a third buffer
     // initializes objects is the destination buffer
     // moves objects from buf_a and destroys the originals
-    // copies objects from buf_b
-    template <typename T, typename C>
-    static void merge_sorted_arrays(const T* buf_a, uint32_t start_a, uint32_t len_a, const T* buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c);
+    // copies objects from buf_b, which can be anything indexable that yields items
+    template <typename T, typename C, typename B>
+    static void merge_sorted_arrays(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c);
 
     struct compress_result {
       uint8_t final_num_levels;
@@ -90,9 +94,9 @@ class kll_helper {
      * sorted afterwards.
      * Level zero is not required to be sorted before, and may not be sorted afterwards.
      */
-    template <typename T, typename C>
+    template <typename T, typename C, typename A>
     static compress_result general_compress(uint16_t k, uint8_t m, uint8_t num_levels_in, T* items,
-            uint32_t* in_levels, uint32_t* out_levels, bool is_level_zero_sorted);
+            uint32_t* in_levels, uint32_t* out_levels, bool is_level_zero_sorted, const A& allocator);
 
     template<typename T>
     static void copy_construct(const T* src, size_t src_first, size_t src_last, T* dst, size_t dst_first);
@@ -100,9 +104,29 @@ class kll_helper {
     template<typename T>
     static void move_construct(T* src, size_t src_first, size_t src_last, T* dst, size_t dst_first, bool destroy);
 
-#ifdef KLL_VALIDATION
   private:
 
+    // arithmetic items go through compaction_kernels, other types are moved one by one
+    template <typename T>
+    static void halve_down(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::true_type);
+    template <typename T>
+    static void halve_down(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::false_type);
+    template <typename T>
+    static void halve_up(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::true_type);
+    template <typename T>
+    static void halve_up(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::false_type);
+
+    template <typename T, typename C>
+    static void merge_in_place(T* buf, uint32_t start_a, uint32_t len_a, uint32_t start_b, uint32_t len_b, uint32_t start_c, std::true_type);
+    template <typename T, typename C>
+    static void merge_in_place(T* buf, uint32_t start_a, uint32_t len_a, uint32_t start_b, uint32_t len_b, uint32_t start_c, std::false_type);
+
+    template <typename T, typename C, typename B>
+    static void merge_into(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c, std::true_type);
+    template <typename T, typename C, typename B>
+    static void merge_into(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c, std::false_type);
+
+#ifdef KLL_VALIDATION
     static inline uint32_t deterministic_offset();
 #endif
 
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 
 #include "common_defs.hpp"
 
@@ -99,8 +100,18 @@ void kll_helper::randomly_halve_down(T* buf, uint32_t start, uint32_t length) {
 #ifdef KLL_VALIDATION
   const uint32_t offset = deterministic_offset();
 #else
-  const uint32_t offset = random_bit();
+  const uint32_t offset = random_utils::random_bit();
 #endif
+  halve_down(buf, start, half_length, offset, compaction_kernels::is_supported<T>());
+}
+
+template <typename T>
+void kll_helper::halve_down(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::true_type) {
+  compaction_kernels::decimate(buf + start + offset, buf + start, half_length);
+}
+
+template <typename T>
+void kll_helper::halve_down(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::false_type) {
   uint32_t j = start + offset;
   for (uint32_t i = start; i < (start + half_length); i++) {
     if (i != j) buf[i] = std::move(buf[j]);
@@ -115,8 +126,19 @@ void kll_helper::randomly_halve_up(T* buf, uint32_t start, uint32_t length) {
 #ifdef KLL_VALIDATION
   const uint32_t offset = deterministic_offset();
 #else
-  const uint32_t offset = random_bit();
+  const uint32_t offset = random_utils::random_bit();
 #endif
+  halve_up(buf, start, half_length, offset, compaction_kernels::is_supported<T>());
+}
+
+template <typename T>
+void kll_helper::halve_up(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::true_type) {
+  compaction_kernels::decimate_backward(buf + start + 1 - offset, buf + start + half_length, half_length);
+}
+
+template <typename T>
+void kll_helper::halve_up(T* buf, uint32_t start, uint32_t half_length, uint32_t offset, std::false_type) {
+  const uint32_t length = half_length * 2;
   uint32_t j = (start + length) - 1 - offset;
   for (uint32_t i = (start + length) - 1; i >= (start + half_length); i--) {
     if (i != j) buf[i] = std::move(buf[j]);
@@ -129,6 +151,16 @@ void kll_helper::randomly_halve_up(T* buf, uint32_t start, uint32_t length) {
 // does not destroy the originals after the move
 template <typename T, typename C>
 void kll_helper::merge_sorted_arrays(T* buf, uint32_t start_a, uint32_t len_a, uint32_t start_b, uint32_t len_b, uint32_t start_c) {
+  merge_in_place<T, C>(buf, start_a, len_a, start_b, len_b, start_c, compaction_kernels::is_supported<T>());
+}
+
+template <typename T, typename C>
+void kll_helper::merge_in_place(T* buf, uint32_t start_a, uint32_t len_a, uint32_t start_b, uint32_t len_b, uint32_t start_c, std::true_type) {
+  compaction_kernels::merge<T, C>(buf + start_a, len_a, buf + start_b, len_b, buf + start_c);
+}
+
+template <typename T, typename C>
+void kll_helper::merge_in_place(T* buf, uint32_t start_a, uint32_t len_a, uint32_t start_b, uint32_t len_b, uint32_t start_c, std::false_type) {
   const uint32_t len_c = len_a + len_b;
   const uint32_t lim_a = start_a + len_a;
   const uint32_t lim_b = start_b + len_b;
@@ -159,8 +191,21 @@ void kll_helper::merge_sorted_arrays(T* buf, uint32_t start_a, uint32_t len_a, u
 // initializes objects is the destination buffer
 // moves objects from buf_a and destroys the originals
 // copies objects from buf_b
-template <typename T, typename C>
-void kll_helper::merge_sorted_arrays(const T* buf_a, uint32_t start_a, uint32_t len_a, const T* buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c) {
+template <typename T, typename C, typename B>
+void kll_helper::merge_sorted_arrays(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c) {
+  // arithmetic items need no construction or destruction, so the kernel can write into the raw buffer
+  using use_kernel = std::integral_constant<bool, compaction_kernels::is_supported<T>::value && std::is_convertible<B, const T*>::value>;
+  merge_into<T, C>(buf_a, start_a, len_a, buf_b, start_b, len_b, buf_c, start_c, use_kernel());
+}
+
+template <typename T, typename C, typename B>
+void kll_helper::merge_into(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c, std::true_type) {
+  const T* items_b = buf_b;
+  compaction_kernels::merge<T, C>(buf_a + start_a, len_a, items_b + start_b, len_b, buf_c + start_c);
+}
+
+template <typename T, typename C, typename B>
+void kll_helper::merge_into(const T* buf_a, uint32_t start_a, uint32_t len_a, const B& buf_b, uint32_t start_b, uint32_t len_b, T* buf_c, uint32_t start_c, std::false_type) {
   const uint32_t len_c = len_a + len_b;
   const uint32_t lim_a = start_a + len_a;
   const uint32_t lim_b = start_b + len_b;
@@ -202,9 +247,9 @@ void kll_helper::merge_sorted_arrays(const T* buf_a, uint32_t start_a, uint32_t
  * sorted afterwards.
  * Level zero is not required to be sorted before, and may not be sorted afterwards.
  */
-template <typename T, typename C>
+template <typename T, typename C, typename A>
 kll_helper::compress_result kll_helper::general_compress(uint16_t k, uint8_t m, uint8_t num_levels_in, T* items,
-        uint32_t* in_levels, uint32_t* out_levels, bool is_level_zero_sorted)
+        uint32_t* in_levels, uint32_t* out_levels, bool is_level_zero_sorted, const A& allocator)
 {
   if (num_levels_in == 0) throw std::invalid_argument("num_levels_in == 0"); // things are too weird if zero levels are allowed
   const uint32_t starting_item_count = in_levels[num_levels_in] - in_levels[0];
@@ -251,7 +296,7 @@ kll_helper::compress_result kll_helper::general_compress(uint16_t k, uint8_t m,
 
       // level zero might not be sorted, so we must sort it if we wish to compact it
       if ((current_level == 0) && !is_level_zero_sorted) {
-        std::sort(items + adj_beg, items + adj_beg + adj_pop, C());
+        sort_utils::sort(items + adj_beg, items + adj_beg + adj_pop, C(), allocator);
       }
 
       if (pop_above == 0) { // Level above is empty, so halve up
@@ -20,12 +20,14 @@
 #ifndef KLL_SKETCH_HPP_
 #define KLL_SKETCH_HPP_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include "common_defs.hpp"
 #include "serde.hpp"
 #include "quantiles_sorted_view.hpp"
+#include "quantiles_snapshot.hpp"
 
 namespace datasketches {
 
@@ -150,6 +152,8 @@ namespace kll_constants {
   const uint16_t DEFAULT_K = 200;
 }
 
+template<typename T, typename C, typename A> class wrapped_kll_sketch;
+
 template <
   typename T,
   typename C = std::less<T>, // strict weak ordering function (see C++ named requirements: Compare)
@@ -165,7 +169,15 @@ class kll_sketch {
     static const uint16_t MIN_K = DEFAULT_M;
     static const uint16_t MAX_K = (1 << 16) - 1;
 
-    explicit kll_sketch(uint16_t k = kll_constants::DEFAULT_K, const C& comparator = C(), const A& allocator = A());
+    /**
+     * Constructor
+     * @param k affects the size of the sketch and its estimation error
+     * @param comparator strict weak ordering function (see C++ named requirements: Compare)
+     * @param allocator used by this sketch to allocate memory
+     * @param expected_n expected length of the input stream to reserve space for, see reserve()
+     */
+    explicit kll_sketch(uint16_t k = kll_constants::DEFAULT_K, const C& comparator = C(), const A& allocator = A(),
+        uint64_t expected_n = 0);
     kll_sketch(const kll_sketch& other);
     kll_sketch(kll_sketch&& other) noexcept;
     ~kll_sketch();
@@ -188,6 +200,16 @@ class kll_sketch {
     template<typename FwdT>
     void update(FwdT&& item);
 
+    /**
+     * Updates this sketch with a range of items, such as a contiguous array given by two pointers.
+     * The result is the same as updating with each item in turn, but level zero is filled in blocks,
+     * and the minimum and maximum are updated once per block.
+     * @param first iterator to the first item
+     * @param last iterator past the last item
+     */
+    template<typename InputIt>
+    void update(InputIt first, InputIt last);
+
     /**
      * Merges another sketch into this one.
      * @param other sketch to merge into this one
@@ -195,6 +217,40 @@ class kll_sketch {
     template<typename FwdSk>
     void merge(FwdSk&& other);
 
+    // work buffers of merges, which can be kept and reused for many merges
+    class merge_buffers;
+
+    /**
+     * Merges another sketch into this one using the given work buffers.
+     * Reusing the same buffers for a series of merges (into this or other sketches of the same type)
+     * avoids allocating and freeing them on every merge. The buffers must not be shared between threads.
+     * @param other sketch to merge into this one
+     * @param buffers work buffers to use
+     */
+    template<typename FwdSk>
+    void merge(FwdSk&& other, merge_buffers& buffers);
+
+    /**
+     * Merges a range of sketches into this one.
+     * The range is split into num_threads parts, each merged by its own thread into a partial sketch,
+     * and the partial sketches are merged pairwise in a balanced tree. Work buffers are reused
+     * between merges. The result has the same accuracy guarantees as merging the sketches one by one.
+     * @param first iterator to the first sketch (anything that can be merged with merge())
+     * @param last iterator past the last sketch
+     * @param num_threads number of threads to use (the calling thread is one of them)
+     */
+    template<typename InputIt>
+    void merge(InputIt first, InputIt last, unsigned num_threads = 1);
+
+    /**
+     * Reserves space for the number of levels that the given stream length needs, so that the sketch
+     * does not have to reallocate its items and move them every time a level is added while updating.
+     * Merges also reuse the reserved space when it is large enough for the result.
+     * The reserved space is not serialized and is not kept by copies.
+     * @param n expected length of the input stream
+     */
+    void reserve(uint64_t n);
+
     /**
      * Returns true if this sketch is empty.
      * @return empty flag
@@ -369,6 +425,22 @@ class kll_sketch {
      */
     vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
 
+    /**
+     * This is a multiple-query version of get_rank().
+     *
+     * <p>If the items are sorted according to the comparator C, they are ranked in one pass
+     * over the sorted view. This is faster than calling get_rank() for each item.
+     *
+     * <p>If the sketch is empty this throws std::runtime_error.
+     *
+     * @param items array of items to be ranked
+     * @param size the number of items in the array
+     * @param inclusive if true the weight of each item is included into its rank
+     *
+     * @return array of approximate normalized ranks of the given items in the same order
+     */
+    vector_double get_ranks(const T* items, uint32_t size, bool inclusive = true) const;
+
     /**
      * Gets the approximate rank error of this sketch normalized as a fraction between zero and one.
      * @param pmf if true, returns the "double-sided" normalized rank error for the get_PMF() function.
@@ -494,6 +566,15 @@ class kll_sketch {
 
     quantiles_sorted_view<T, C, A> get_sorted_view() const;
 
+    /**
+     * Returns an immutable snapshot of the sketch for queries.
+     * The snapshot has the sorted view built and its own copies of the items,
+     * so it is not affected by later updates and can be queried from many threads at once.
+     * Queries on the sketch itself are also safe to run concurrently as long as nothing modifies the sketch.
+     * @return snapshot for queries
+     */
+    quantiles_snapshot<T, C, A> freeze() const;
+
   private:
     /* Serialized sketch layout:
      *  Addr:
@@ -529,13 +610,16 @@ class kll_sketch {
     vector_u32 levels_;
     T* items_;
     uint32_t items_size_;
+    uint32_t items_headroom_; // allocated space below items_ reserved for new levels
     T* min_item_;
     T* max_item_;
-    mutable quantiles_sorted_view<T, C, A>* sorted_view_;
+    mutable std::atomic<quantiles_sorted_view<T, C, A>*> sorted_view_; // built by the first query
 
     // for deserialization
     class item_deleter;
     class items_deleter;
+    // destroys the items of a block of level zero built so far, unless the block is released
+    class block_guard;
     kll_sketch(uint16_t k, uint16_t min_k, uint64_t n, uint8_t num_levels, vector_u32&& levels,
         std::unique_ptr<T, items_deleter> items, uint32_t items_size, std::unique_ptr<T, item_deleter> min_item,
         std::unique_ptr<T, item_deleter> max_item, bool is_level_zero_sorted, const C& comparator);
@@ -550,14 +634,31 @@ class kll_sketch {
 
     uint8_t find_level_to_compact() const;
     void add_empty_top_level_to_completely_full_sketch();
-    void sort_level_zero();
 
-    template<typename O> void merge_higher_levels(O&& other, uint64_t final_n);
+    template<typename O> void merge_higher_levels(O&& other, uint64_t final_n, merge_buffers& buffers);
+
+    uint32_t get_capacity_for(uint64_t n) const;
+    // makes the items array of the given capacity, reusing the allocation if it is large enough
+    void set_items_capacity(uint32_t capacity);
+    void deallocate_items();
 
     template<typename FwdSk>
     void populate_work_arrays(FwdSk&& other, T* workbuf, uint32_t* worklevels, uint8_t provisional_num_levels);
 
     void assert_correct_total_weight() const;
+
+    // merge() reads the other sketch only through these accessors and the public queries,
+    // and wrapped_kll_sketch has the same ones, so that it can be merged like a sketch
+    uint8_t get_m() const;
+    uint16_t get_min_k() const;
+    uint8_t get_num_levels() const;
+    const vector_u32& get_levels() const;
+    T* get_items();
+    const T* get_items() const;
+    T& stored_min_item();
+    const T& stored_min_item() const;
+    T& stored_max_item();
+    const T& stored_max_item() const;
     uint32_t safe_level_size(uint8_t level) const;
     uint32_t get_num_retained_above_level_zero() const;
 
@@ -581,10 +682,30 @@ class kll_sketch {
     // for type converting constructor
     template<typename TT, typename CC, typename AA> friend class kll_sketch;
 
-    void setup_sorted_view() const; // modifies mutable state
+    // reads the preamble of a serialized image
+    friend class wrapped_kll_sketch<T, C, A>;
+
+    const quantiles_sorted_view<T, C, A>& setup_sorted_view() const; // safe for concurrent queries
     void reset_sorted_view();
 };
 
+template<typename T, typename C, typename A>
+class kll_sketch<T, C, A>::merge_buffers {
+public:
+  explicit merge_buffers(const A& allocator = A());
+  ~merge_buffers();
+  merge_buffers(const merge_buffers&) = delete;
+  merge_buffers& operator=(const merge_buffers&) = delete;
+  // uninitialized space for the given number of items
+  T* get_items(uint32_t size);
+  vector_u32 worklevels;
+  vector_u32 outlevels;
+private:
+  A allocator_;
+  T* items_;
+  uint32_t capacity_;
+};
+
 template<typename T, typename C, typename A>
 class kll_sketch<T, C, A>::const_iterator: public std::iterator<std::input_iterator_tag, T> {
 public:
@@ -606,6 +727,194 @@ private:
   const_iterator(const T* items, const uint32_t* levels, const uint8_t num_levels);
 };
 
+/**
+ * Read-only view of a serialized KLL sketch of an arithmetic type
+ * (serialized with the default serde, which writes the bytes of items).
+ * Queries are answered directly from the serialized image. Only level zero is copied and sorted, once by wrap(),
+ * and only if it is not sorted in the image. This is cheaper than deserialize() if only a few queries are made
+ * before discarding the sketch.
+ * The view can be merged into a kll_sketch like another sketch.
+ * The view does not copy the bytes, which must outlive it.
+ */
+template <
+  typename T,
+  typename C = std::less<T>, // strict weak ordering function (see C++ named requirements: Compare)
+  typename A = std::allocator<T>
+>
+class wrapped_kll_sketch {
+  static_assert(std::is_arithmetic<T>::value, "wrapped_kll_sketch requires an arithmetic type");
+public:
+  using value_type = T;
+  using comparator = C;
+  using vector_double = typename quantiles_sorted_view<T, C, A>::vector_double;
+
+  /**
+   * This method wraps a serialized sketch. The image is checked the same way as in
+   * kll_sketch::deserialize(), and the levels are checked to be consistent.
+   * @param bytes pointer to the array of bytes
+   * @param size the size of the array
+   * @param comparator instance of a Comparator
+   * @param allocator instance of an Allocator for query results
+   * @return an instance of the view
+   */
+  static wrapped_kll_sketch wrap(const void* bytes, size_t size, const C& comparator = C(), const A& allocator = A());
+
+  /**
+   * Returns true if the sketch is empty.
+   * @return empty flag
+   */
+  bool is_empty() const;
+
+  /**
+   * Returns configured parameter k
+   * @return parameter k
+   */
+  uint16_t get_k() const;
+
+  /**
+   * Returns the length of the input stream.
+   * @return stream length
+   */
+  uint64_t get_n() const;
+
+  /**
+   * Returns the number of retained items (samples) in the sketch.
+   * @return the number of retained items
+   */
+  uint32_t get_num_retained() const;
+
+  /**
+   * Returns true if the sketch is in estimation mode.
+   * @return estimation mode flag
+   */
+  bool is_estimation_mode() const;
+
+  /**
+   * Returns the min item of the stream.
+   * If the sketch is empty this throws std::runtime_error.
+   * @return the min item of the stream
+   */
+  T get_min_item() const;
+
+  /**
+   * Returns the max item of the stream.
+   * If the sketch is empty this throws std::runtime_error.
+   * @return the max item of the stream
+   */
+  T get_max_item() const;
+
+  /**
+   * Returns the same normalized rank as kll_sketch::get_rank() would after deserialization.
+   * If the sketch is empty this throws std::runtime_error.
+   * @param item to be ranked
+   * @param inclusive if true the weight of the given item is included into the rank
+   * @return an approximate rank of the given item
+   */
+  double get_rank(const T& item, bool inclusive = true) const;
+
+  /**
+   * Returns the same quantile as kll_sketch::get_quantile() would after deserialization.
+   * If the sketch is empty this throws std::runtime_error.
+   * @param rank of an item in the hypothetical sorted stream
+   * @param inclusive if true, the given rank is considered inclusive (includes weight of an item)
+   * @return approximate quantile associated with the given rank
+   */
+  T get_quantile(double rank, bool inclusive = true) const;
+
+  /**
+   * Returns the same PMF as kll_sketch::get_PMF() would after deserialization.
+   * If the sketch is empty this throws std::runtime_error.
+   * @param split_points an array of <i>m</i> unique, monotonically increasing items
+   * @param size the number of split points in the array
+   * @param inclusive if true the rank of an item includes its own weight
+   * @return an array of m+1 doubles each of which is an approximation
+   * to the fraction of the input stream items (the mass) that fall into one of those intervals.
+   */
+  vector_double get_PMF(const T* split_points, uint32_t size, bool inclusive = true) const;
+
+  /**
+   * Returns the same CDF as kll_sketch::get_CDF() would after deserialization.
+   * If the sketch is empty this throws std::runtime_error.
+   * @param split_points an array of <i>m</i> unique, monotonically increasing items
+   * @param size the number of split points in the array
+   * @param inclusive if true the rank of an item includes its own weight
+   * @return an array of m+1 doubles, which are a consecutive approximation to the CDF
+   * of the input stream given the split_points.
+   */
+  vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
+
+  /**
+   * Gets the approximate rank error of the sketch normalized as a fraction between zero and one.
+   * @param pmf if true, returns the "double-sided" normalized rank error for the get_PMF() function.
+   * Otherwise, it is the "single-sided" normalized rank error for all the other queries.
+   * @return if pmf is true, returns the normalized rank error for the get_PMF() function.
+   * Otherwise, it is the "single-sided" normalized rank error for all the other queries.
+   */
+  double get_normalized_rank_error(bool pmf) const;
+
+private:
+  // reads items from the serialized image, which may be unaligned
+  class item_reader {
+  public:
+    explicit item_reader(const char* ptr = nullptr): ptr_(ptr) {}
+    T operator[](uint32_t index) const;
+    T operator*() const { return (*this)[0]; }
+  private:
+    const char* ptr_;
+  };
+
+  // reads levels relative to the first retained item, deriving the last one as kll_sketch does
+  class levels_reader {
+  public:
+    levels_reader(const char* ptr = nullptr, uint8_t num_levels = 0, uint32_t offset = 0, uint32_t capacity = 0);
+    uint32_t operator[](uint8_t level) const;
+  private:
+    const char* ptr_; // null for a single item
+    uint8_t num_levels_;
+    uint32_t offset_;
+    uint32_t capacity_;
+  };
+
+  C comparator_;
+  A allocator_;
+  uint16_t k_;
+  uint8_t m_;
+  uint16_t min_k_;
+  uint8_t num_levels_;
+  bool is_level_zero_sorted_;
+  uint64_t n_;
+  levels_reader levels_;
+  item_reader items_;
+  item_reader min_item_;
+  item_reader max_item_;
+  std::vector<T, A> sorted_level_zero_; // empty if level zero is sorted in the image
+
+  wrapped_kll_sketch(const C& comparator, const A& allocator);
+
+  // the accessors that kll_sketch::merge() uses
+  uint8_t get_m() const;
+  uint16_t get_min_k() const;
+  uint8_t get_num_levels() const;
+  const levels_reader& get_levels() const;
+  const item_reader& get_items() const;
+  T stored_min_item() const;
+  T stored_max_item() const;
+  uint32_t safe_level_size(uint8_t level) const;
+  uint32_t get_num_retained_above_level_zero() const;
+
+  // level zero in sorted order: the sorted copy or the items in the image
+  bool has_sorted_copy() const;
+
+  // total weight of retained items less than (or equal to if inclusive) the given item
+  uint64_t get_weight(const T& item, bool inclusive) const;
+
+  // index of the first item in a range for which the predicate is false, the range being partitioned by it
+  template<typename Items, typename Predicate>
+  static uint32_t partition_point(const Items& items, uint32_t first, uint32_t last, Predicate pred);
+
+  friend class kll_sketch<T, C, A>;
+};
+
 } /* namespace datasketches */
 
 #include "kll_sketch_impl.hpp"
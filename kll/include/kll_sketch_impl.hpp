@@ -20,10 +20,16 @@
 #ifndef KLL_SKETCH_IMPL_HPP_
 #define KLL_SKETCH_IMPL_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
 
 #include "conditional_forward.hpp"
 #include "count_zeros.hpp"
@@ -33,7 +39,7 @@
 namespace datasketches {
 
 template<typename T, typename C, typename A>
-kll_sketch<T, C, A>::kll_sketch(uint16_t k, const C& comparator, const A& allocator):
+kll_sketch<T, C, A>::kll_sketch(uint16_t k, const C& comparator, const A& allocator, uint64_t expected_n):
 comparator_(comparator),
 allocator_(allocator),
 k_(k),
@@ -45,6 +51,7 @@ n_(0),
 levels_(2, 0, allocator),
 items_(nullptr),
 items_size_(k_),
+items_headroom_(0),
 min_item_(nullptr),
 max_item_(nullptr),
 sorted_view_(nullptr)
@@ -53,7 +60,9 @@ sorted_view_(nullptr)
     throw std::invalid_argument("K must be >= " + std::to_string(MIN_K) + " and <= " + std::to_string(MAX_K) + ": " + std::to_string(k));
   }
   levels_[0] = levels_[1] = k;
-  items_ = allocator_.allocate(items_size_);
+  const uint32_t capacity = get_capacity_for(expected_n);
+  items_headroom_ = capacity - items_size_;
+  items_ = allocator_.allocate(capacity) + items_headroom_;
 }
 
 template<typename T, typename C, typename A>
@@ -69,6 +78,7 @@ n_(other.n_),
 levels_(other.levels_),
 items_(nullptr),
 items_size_(other.items_size_),
+items_headroom_(0),
 min_item_(nullptr),
 max_item_(nullptr),
 sorted_view_(nullptr)
@@ -92,6 +102,7 @@ n_(other.n_),
 levels_(std::move(other.levels_)),
 items_(other.items_),
 items_size_(other.items_size_),
+items_headroom_(other.items_headroom_),
 min_item_(other.min_item_),
 max_item_(other.max_item_),
 sorted_view_(nullptr)
@@ -115,6 +126,7 @@ kll_sketch<T, C, A>& kll_sketch<T, C, A>::operator=(const kll_sketch& other) {
   std::swap(levels_, copy.levels_);
   std::swap(items_, copy.items_);
   std::swap(items_size_, copy.items_size_);
+  std::swap(items_headroom_, copy.items_headroom_);
   std::swap(min_item_, copy.min_item_);
   std::swap(max_item_, copy.max_item_);
   reset_sorted_view();
@@ -134,6 +146,7 @@ kll_sketch<T, C, A>& kll_sketch<T, C, A>::operator=(kll_sketch&& other) {
   std::swap(levels_, other.levels_);
   std::swap(items_, other.items_);
   std::swap(items_size_, other.items_size_);
+  std::swap(items_headroom_, other.items_headroom_);
   std::swap(min_item_, other.min_item_);
   std::swap(max_item_, other.max_item_);
   reset_sorted_view();
@@ -146,7 +159,7 @@ kll_sketch<T, C, A>::~kll_sketch() {
     const uint32_t begin = levels_[0];
     const uint32_t end = levels_[num_levels_];
     for (uint32_t i = begin; i < end; i++) items_[i].~T();
-    allocator_.deallocate(items_, items_size_);
+    deallocate_items();
   }
   if (min_item_ != nullptr) {
     min_item_->~T();
@@ -173,6 +186,7 @@ n_(other.n_),
 levels_(other.levels_, allocator_),
 items_(nullptr),
 items_size_(other.items_size_),
+items_headroom_(0),
 min_item_(nullptr),
 max_item_(nullptr),
 sorted_view_(nullptr)
@@ -198,6 +212,41 @@ void kll_sketch<T, C, A>::update(FwdT&& item) {
   reset_sorted_view();
 }
 
+template<typename T, typename C, typename A>
+template<typename InputIt>
+void kll_sketch<T, C, A>::update(InputIt first, InputIt last) {
+  reset_sorted_view();
+  while (first != last) {
+    if (levels_[0] == 0) compress_while_updating();
+    // free slots of level zero are below levels_[0] and are filled downwards
+    uint32_t index = levels_[0];
+    const T* block_min = nullptr;
+    const T* block_max = nullptr;
+    // the block is counted in levels_[0] and n_ once min and max are updated,
+    // until then it is destroyed in case of an exception
+    block_guard block(items_, index, levels_[0]);
+    for (; index > 0 && first != last; ++first) {
+      if (!check_update_item(*first)) continue;
+      new (&items_[index - 1]) T(*first);
+      const T& item = items_[--index];
+      if (block_min == nullptr || comparator_(item, *block_min)) block_min = &item;
+      if (block_max == nullptr || comparator_(*block_max, item)) block_max = &item;
+    }
+    if (block_min == nullptr) continue;
+    if (is_empty()) {
+      min_item_ = new (allocator_.allocate(1)) T(*block_min);
+      max_item_ = new (allocator_.allocate(1)) T(*block_max);
+    } else {
+      if (comparator_(*block_min, *min_item_)) *min_item_ = *block_min;
+      if (comparator_(*max_item_, *block_max)) *max_item_ = *block_max;
+    }
+    block.release();
+    n_ += levels_[0] - index;
+    levels_[0] = index;
+    is_level_zero_sorted_ = false;
+  }
+}
+
 template<typename T, typename C, typename A>
 void kll_sketch<T, C, A>::update_min_max(const T& item) {
   if (is_empty()) {
@@ -220,25 +269,89 @@ uint32_t kll_sketch<T, C, A>::internal_update() {
 template<typename T, typename C, typename A>
 template<typename FwdSk>
 void kll_sketch<T, C, A>::merge(FwdSk&& other) {
+  merge_buffers buffers(allocator_);
+  merge(std::forward<FwdSk>(other), buffers);
+}
+
+template<typename T, typename C, typename A>
+template<typename InputIt>
+void kll_sketch<T, C, A>::merge(InputIt first, InputIt last, unsigned num_threads) {
+  using Sketch = typename std::iterator_traits<InputIt>::value_type;
+  using AllocSketchPtr = typename std::allocator_traits<A>::template rebind_alloc<const Sketch*>;
+  std::vector<const Sketch*, AllocSketchPtr> sketches(allocator_);
+  for (; first != last; ++first) sketches.push_back(&*first);
+  num_threads = std::max(1U, std::min(num_threads, static_cast<unsigned>(sketches.size())));
+
+  // this sketch takes the first part, the other parts go to partial sketches
+  using AllocSketch = typename std::allocator_traits<A>::template rebind_alloc<kll_sketch>;
+  std::vector<kll_sketch, AllocSketch> partials(num_threads - 1, kll_sketch(k_, comparator_, allocator_), allocator_);
+  using AllocTarget = typename std::allocator_traits<A>::template rebind_alloc<kll_sketch*>;
+  std::vector<kll_sketch*, AllocTarget> targets(allocator_);
+  targets.push_back(this);
+  for (auto& partial: partials) targets.push_back(&partial);
+
+  // exceptions are passed from the other threads to the calling one
+  using AllocException = typename std::allocator_traits<A>::template rebind_alloc<std::exception_ptr>;
+  std::vector<std::exception_ptr, AllocException> exceptions(num_threads, nullptr, allocator_);
+  auto run_in_parallel = [&](unsigned num_tasks, const std::function<void(unsigned)>& task) {
+    auto run = [&](unsigned i) {
+      try {
+        task(i);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_tasks - 1);
+    for (unsigned i = 1; i < num_tasks; ++i) threads.emplace_back(run, i);
+    run(0);
+    for (auto& thread: threads) thread.join();
+    for (const auto& exception: exceptions) {
+      if (exception != nullptr) std::rethrow_exception(exception);
+    }
+  };
+
+  const size_t num_sketches = sketches.size();
+  run_in_parallel(num_threads, [&](unsigned i) {
+    merge_buffers buffers(allocator_);
+    for (size_t j = num_sketches * i / num_threads; j < num_sketches * (i + 1) / num_threads; ++j) {
+      targets[i]->merge(*sketches[j], buffers);
+    }
+  });
+
+  // balanced tree of merges of partial sketches, one level at a time
+  for (unsigned step = 1; step < num_threads; step *= 2) {
+    const unsigned num_merges = (num_threads - step + 2 * step - 1) / (2 * step);
+    run_in_parallel(num_merges, [&](unsigned i) {
+      merge_buffers buffers(allocator_);
+      targets[2 * step * i]->merge(std::move(*targets[2 * step * i + step]), buffers);
+    });
+  }
+}
+
+template<typename T, typename C, typename A>
+template<typename FwdSk>
+void kll_sketch<T, C, A>::merge(FwdSk&& other, merge_buffers& buffers) {
   if (other.is_empty()) return;
-  if (m_ != other.m_) {
-    throw std::invalid_argument("incompatible M: " + std::to_string(m_) + " and " + std::to_string(other.m_));
+  if (m_ != other.get_m()) {
+    throw std::invalid_argument("incompatible M: " + std::to_string(m_) + " and " + std::to_string(other.get_m()));
   }
   if (is_empty()) {
-    min_item_ = new (allocator_.allocate(1)) T(conditional_forward<FwdSk>(*other.min_item_));
-    max_item_ = new (allocator_.allocate(1)) T(conditional_forward<FwdSk>(*other.max_item_));
+    min_item_ = new (allocator_.allocate(1)) T(conditional_forward<FwdSk>(other.stored_min_item()));
+    max_item_ = new (allocator_.allocate(1)) T(conditional_forward<FwdSk>(other.stored_max_item()));
   } else {
-    if (comparator_(*other.min_item_, *min_item_)) *min_item_ = conditional_forward<FwdSk>(*other.min_item_);
-    if (comparator_(*max_item_, *other.max_item_)) *max_item_ = conditional_forward<FwdSk>(*other.max_item_);
+    if (comparator_(other.stored_min_item(), *min_item_)) *min_item_ = conditional_forward<FwdSk>(other.stored_min_item());
+    if (comparator_(*max_item_, other.stored_max_item())) *max_item_ = conditional_forward<FwdSk>(other.stored_max_item());
   }
-  const uint64_t final_n = n_ + other.n_;
-  for (uint32_t i = other.levels_[0]; i < other.levels_[1]; i++) {
+  const uint64_t final_n = n_ + other.get_n();
+  const auto& other_levels = other.get_levels();
+  for (uint32_t i = other_levels[0]; i < other_levels[1]; i++) {
     const uint32_t index = internal_update();
-    new (&items_[index]) T(conditional_forward<FwdSk>(other.items_[i]));
+    new (&items_[index]) T(conditional_forward<FwdSk>(other.get_items()[i]));
   }
-  if (other.num_levels_ >= 2) merge_higher_levels(other, final_n);
+  if (other.get_num_levels() >= 2) merge_higher_levels(other, final_n, buffers);
   n_ = final_n;
-  if (other.is_estimation_mode()) min_k_ = std::min(min_k_, other.min_k_);
+  if (other.is_estimation_mode()) min_k_ = std::min(min_k_, other.get_min_k());
   assert_correct_total_weight();
   reset_sorted_view();
 }
@@ -293,22 +406,25 @@ A kll_sketch<T, C, A>::get_allocator() const {
 template<typename T, typename C, typename A>
 double kll_sketch<T, C, A>::get_rank(const T& item, bool inclusive) const {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_rank(item, inclusive);
+  return setup_sorted_view().get_rank(item, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto kll_sketch<T, C, A>::get_ranks(const T* items, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return setup_sorted_view().get_ranks(items, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 auto kll_sketch<T, C, A>::get_PMF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_PMF(split_points, size, inclusive);
+  return setup_sorted_view().get_PMF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 auto kll_sketch<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_CDF(split_points, size, inclusive);
+  return setup_sorted_view().get_CDF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
@@ -317,28 +433,19 @@ auto kll_sketch<T, C, A>::get_quantile(double rank, bool inclusive) const -> qua
   if ((rank < 0.0) || (rank > 1.0)) {
     throw std::invalid_argument("normalized rank cannot be less than zero or greater than 1.0");
   }
-  // may have a side effect of sorting level zero if needed
-  setup_sorted_view();
-  return sorted_view_->get_quantile(rank, inclusive);
+  return setup_sorted_view().get_quantile(rank, inclusive);
 }
 
 template<typename T, typename C, typename A>
 std::vector<T, A> kll_sketch<T, C, A>::get_quantiles(const double* ranks, uint32_t size, bool inclusive) const {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  std::vector<T, A> quantiles(allocator_);
-  quantiles.reserve(size);
-
-  // may have a side effect of sorting level zero if needed
-  setup_sorted_view();
-
   for (uint32_t i = 0; i < size; i++) {
     const double rank = ranks[i];
     if ((rank < 0.0) || (rank > 1.0)) {
       throw std::invalid_argument("normalized rank cannot be less than 0 or greater than 1");
     }
-    quantiles.push_back(sorted_view_->get_quantile(rank, inclusive));
   }
-  return quantiles;
+  return setup_sorted_view().get_quantiles(ranks, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
@@ -683,6 +790,7 @@ n_(n),
 levels_(std::move(levels)),
 items_(items.release()),
 items_size_(items_size),
+items_headroom_(0),
 min_item_(min_item.release()),
 max_item_(max_item.release()),
 sorted_view_(nullptr)
@@ -713,9 +821,8 @@ void kll_sketch<T, C, A>::compress_while_updating(void) {
   const uint32_t destroy_beg = levels_[0];
 
   // level zero might not be sorted, so we must sort it if we wish to compact it
-  // sort_level_zero() is not used here because of the adjustment for odd number of items
   if ((level == 0) && !is_level_zero_sorted_) {
-    std::sort(items_ + adj_beg, items_ + adj_beg + adj_pop, comparator_);
+    sort_utils::sort(items_ + adj_beg, items_ + adj_beg + adj_pop, comparator_, allocator_);
   }
   if (pop_above == 0) {
     kll_helper::randomly_halve_up(items_, adj_beg, adj_pop);
@@ -775,11 +882,21 @@ void kll_sketch<T, C, A>::add_empty_top_level_to_completely_full_sketch() {
   const uint32_t delta_cap = kll_helper::level_capacity(k_, num_levels_ + 1, 0, m_);
   const uint32_t new_total_cap = cur_total_cap + delta_cap;
 
-  // move (and shift) the current data into the new buffer
-  T* new_buf = allocator_.allocate(new_total_cap);
-  kll_helper::move_construct<T>(items_, 0, cur_total_cap, new_buf, delta_cap, true);
-  allocator_.deallocate(items_, items_size_);
-  items_ = new_buf;
+  if (items_headroom_ >= delta_cap) {
+    // the array is extended down into the reserved space, the items stay where they are
+    items_ -= delta_cap;
+    items_headroom_ -= delta_cap;
+  } else {
+    // move (and shift) the current data into a new buffer with room for more levels:
+    // the number of levels is doubled, but grows by at most 8 levels at a time
+    const uint8_t reserved_levels = num_levels_ + std::min<uint8_t>(num_levels_, 8);
+    const uint32_t reserved_cap = kll_helper::compute_total_capacity(k_, m_, reserved_levels);
+    T* new_buf = allocator_.allocate(reserved_cap) + reserved_cap - new_total_cap;
+    kll_helper::move_construct<T>(items_, 0, cur_total_cap, new_buf, delta_cap, true);
+    deallocate_items();
+    items_ = new_buf;
+    items_headroom_ = reserved_cap - new_total_cap;
+  }
   items_size_ = new_total_cap;
 
   // this loop includes the old "extra" index at the top
@@ -794,11 +911,52 @@ void kll_sketch<T, C, A>::add_empty_top_level_to_completely_full_sketch() {
 }
 
 template<typename T, typename C, typename A>
-void kll_sketch<T, C, A>::sort_level_zero() {
-  if (!is_level_zero_sorted_) {
-    std::sort(items_ + levels_[0], items_ + levels_[1], comparator_);
-    is_level_zero_sorted_ = true;
+uint32_t kll_sketch<T, C, A>::get_capacity_for(uint64_t n) const {
+  // the fewest levels that can hold the total weight n when full
+  const uint8_t max_levels = kll_helper::ub_on_num_levels(n);
+  uint8_t num_levels = num_levels_;
+  while (num_levels < max_levels) {
+    uint64_t max_weight = 0;
+    for (uint8_t h = 0; h < num_levels; ++h) {
+      max_weight += static_cast<uint64_t>(kll_helper::level_capacity(k_, num_levels, h, m_)) << h;
+    }
+    if (max_weight >= n) break;
+    ++num_levels;
   }
+  return kll_helper::compute_total_capacity(k_, m_, num_levels);
+}
+
+template<typename T, typename C, typename A>
+void kll_sketch<T, C, A>::reserve(uint64_t n) {
+  const uint32_t capacity = get_capacity_for(n);
+  if (capacity <= items_size_ + items_headroom_) return;
+  T* new_items = allocator_.allocate(capacity) + capacity - items_size_;
+  kll_helper::move_construct<T>(items_, levels_[0], levels_[num_levels_], new_items, levels_[0], true);
+  deallocate_items();
+  items_ = new_items;
+  items_headroom_ = capacity - items_size_;
+}
+
+template<typename T, typename C, typename A>
+void kll_sketch<T, C, A>::set_items_capacity(uint32_t capacity) {
+  const uint32_t allocated = items_size_ + items_headroom_;
+  if (capacity <= allocated) {
+    // the array ends at the end of the allocation, the rest is headroom
+    T* base = items_ - items_headroom_;
+    items_headroom_ = allocated - capacity;
+    items_ = base + items_headroom_;
+  } else {
+    deallocate_items();
+    items_ = nullptr; // in case allocation throws
+    items_headroom_ = 0;
+    items_ = allocator_.allocate(capacity);
+  }
+  items_size_ = capacity;
+}
+
+template<typename T, typename C, typename A>
+void kll_sketch<T, C, A>::deallocate_items() {
+  allocator_.deallocate(items_ - items_headroom_, items_size_ + items_headroom_);
 }
 
 template<typename T, typename C, typename A>
@@ -815,47 +973,51 @@ void kll_sketch<T, C, A>::check_sorting() const {
 
 template<typename T, typename C, typename A>
 quantiles_sorted_view<T, C, A> kll_sketch<T, C, A>::get_sorted_view() const {
-  const_cast<kll_sketch*>(this)->sort_level_zero(); // allow this side effect
   quantiles_sorted_view<T, C, A> view(get_num_retained(), comparator_, allocator_);
   for (uint8_t level = 0; level < num_levels_; ++level) {
     const auto from = items_ + levels_[level];
     const auto to = items_ + levels_[level + 1]; // exclusive
-    view.add(from, to, 1 << level);
+    if (level == 0 && !is_level_zero_sorted_) {
+      view.add_unsorted(from, to, 1); // level zero is left as is, so that queries do not modify the sketch
+    } else {
+      view.add(from, to, 1 << level);
+    }
   }
   view.convert_to_cummulative();
   return view;
 }
 
+template<typename T, typename C, typename A>
+quantiles_snapshot<T, C, A> kll_sketch<T, C, A>::freeze() const {
+  return quantiles_snapshot<T, C, A>(get_sorted_view(), n_, min_item_, max_item_, allocator_);
+}
+
 template<typename T, typename C, typename A>
 template<typename O>
-void kll_sketch<T, C, A>::merge_higher_levels(O&& other, uint64_t final_n) {
+void kll_sketch<T, C, A>::merge_higher_levels(O&& other, uint64_t final_n, merge_buffers& buffers) {
   const uint32_t tmp_num_items = get_num_retained() + other.get_num_retained_above_level_zero();
-  A alloc(allocator_);
-  auto tmp_items_deleter = [tmp_num_items, &alloc](T* ptr) { alloc.deallocate(ptr, tmp_num_items); }; // no destructor needed
-  const std::unique_ptr<T, decltype(tmp_items_deleter)> workbuf(allocator_.allocate(tmp_num_items), tmp_items_deleter);
+  T* workbuf = buffers.get_items(tmp_num_items); // no destructor needed
   const uint8_t ub = kll_helper::ub_on_num_levels(final_n);
   const size_t work_levels_size = ub + 2; // ub+1 does not work
-  vector_u32 worklevels(work_levels_size, 0, allocator_);
-  vector_u32 outlevels(work_levels_size, 0, allocator_);
+  vector_u32& worklevels = buffers.worklevels;
+  vector_u32& outlevels = buffers.outlevels;
+  worklevels.assign(work_levels_size, 0);
+  outlevels.assign(work_levels_size, 0);
 
-  const uint8_t provisional_num_levels = std::max(num_levels_, other.num_levels_);
+  const uint8_t provisional_num_levels = std::max(num_levels_, other.get_num_levels());
 
-  populate_work_arrays(std::forward<O>(other), workbuf.get(), worklevels.data(), provisional_num_levels);
+  populate_work_arrays(std::forward<O>(other), workbuf, worklevels.data(), provisional_num_levels);
 
-  const kll_helper::compress_result result = kll_helper::general_compress<T, C>(k_, m_, provisional_num_levels, workbuf.get(),
-      worklevels.data(), outlevels.data(), is_level_zero_sorted_);
+  const kll_helper::compress_result result = kll_helper::general_compress<T, C>(k_, m_, provisional_num_levels, workbuf,
+      worklevels.data(), outlevels.data(), is_level_zero_sorted_, allocator_);
 
   // ub can sometimes be much bigger
   if (result.final_num_levels > ub) throw std::logic_error("merge error");
 
   // now we need to transfer the results back into "this" sketch
-  if (result.final_capacity != items_size_) {
-    allocator_.deallocate(items_, items_size_);
-    items_size_ = result.final_capacity;
-    items_ = allocator_.allocate(items_size_);
-  }
+  set_items_capacity(result.final_capacity);
   const uint32_t free_space_at_bottom = result.final_capacity - result.final_num_items;
-  kll_helper::move_construct<T>(workbuf.get(), outlevels[0], outlevels[0] + result.final_num_items, items_, free_space_at_bottom, true);
+  kll_helper::move_construct<T>(workbuf, outlevels[0], outlevels[0] + result.final_num_items, items_, free_space_at_bottom, true);
 
   const size_t new_levels_size = result.final_num_levels + 1;
   if (levels_.size() < new_levels_size) {
@@ -886,11 +1048,12 @@ void kll_sketch<T, C, A>::populate_work_arrays(FwdSk&& other, T* workbuf, uint32
     if ((self_pop > 0) && (other_pop == 0)) {
       kll_helper::move_construct<T>(items_, levels_[lvl], levels_[lvl] + self_pop, workbuf, worklevels[lvl], true);
     } else if ((self_pop == 0) && (other_pop > 0)) {
-      for (auto i = other.levels_[lvl], j = worklevels[lvl]; i < other.levels_[lvl] + other_pop; ++i, ++j) {
-        new (&workbuf[j]) T(conditional_forward<FwdSk>(other.items_[i]));
+      const uint32_t other_begin = other.get_levels()[lvl];
+      for (auto i = other_begin, j = worklevels[lvl]; i < other_begin + other_pop; ++i, ++j) {
+        new (&workbuf[j]) T(conditional_forward<FwdSk>(other.get_items()[i]));
       }
     } else if ((self_pop > 0) && (other_pop > 0)) {
-      kll_helper::merge_sorted_arrays<T, C>(items_, levels_[lvl], self_pop, other.items_, other.levels_[lvl], other_pop, workbuf, worklevels[lvl]);
+      kll_helper::merge_sorted_arrays<T, C>(items_, levels_[lvl], self_pop, other.get_items(), other.get_levels()[lvl], other_pop, workbuf, worklevels[lvl]);
     }
   }
 }
@@ -903,6 +1066,56 @@ void kll_sketch<T, C, A>::assert_correct_total_weight() const {
   }
 }
 
+template<typename T, typename C, typename A>
+uint8_t kll_sketch<T, C, A>::get_m() const {
+  return m_;
+}
+
+template<typename T, typename C, typename A>
+uint16_t kll_sketch<T, C, A>::get_min_k() const {
+  return min_k_;
+}
+
+template<typename T, typename C, typename A>
+uint8_t kll_sketch<T, C, A>::get_num_levels() const {
+  return num_levels_;
+}
+
+template<typename T, typename C, typename A>
+auto kll_sketch<T, C, A>::get_levels() const -> const vector_u32& {
+  return levels_;
+}
+
+template<typename T, typename C, typename A>
+T* kll_sketch<T, C, A>::get_items() {
+  return items_;
+}
+
+template<typename T, typename C, typename A>
+const T* kll_sketch<T, C, A>::get_items() const {
+  return items_;
+}
+
+template<typename T, typename C, typename A>
+T& kll_sketch<T, C, A>::stored_min_item() {
+  return *min_item_;
+}
+
+template<typename T, typename C, typename A>
+const T& kll_sketch<T, C, A>::stored_min_item() const {
+  return *min_item_;
+}
+
+template<typename T, typename C, typename A>
+T& kll_sketch<T, C, A>::stored_max_item() {
+  return *max_item_;
+}
+
+template<typename T, typename C, typename A>
+const T& kll_sketch<T, C, A>::stored_max_item() const {
+  return *max_item_;
+}
+
 template<typename T, typename C, typename A>
 uint32_t kll_sketch<T, C, A>::safe_level_size(uint8_t level) const {
   if (level >= num_levels_) return 0;
@@ -1051,23 +1264,79 @@ class kll_sketch<T, C, A>::items_deleter {
 };
 
 template<typename T, typename C, typename A>
-void kll_sketch<T, C, A>::setup_sorted_view() const {
-  if (sorted_view_ == nullptr) {
+class kll_sketch<T, C, A>::block_guard {
+  public:
+  // the block is items[first, last), and first moves down as the block grows
+  block_guard(T* items, const uint32_t& first, uint32_t last): items_(items), first_(first), last_(last) {}
+  block_guard(const block_guard&) = delete;
+  block_guard& operator=(const block_guard&) = delete;
+  ~block_guard() {
+    for (uint32_t i = first_; i < last_; ++i) items_[i].~T();
+  }
+  void release() { last_ = first_; }
+  private:
+  T* items_;
+  const uint32_t& first_;
+  uint32_t last_;
+};
+
+template<typename T, typename C, typename A>
+auto kll_sketch<T, C, A>::setup_sorted_view() const -> const quantiles_sorted_view<T, C, A>& {
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.load(std::memory_order_acquire);
+  if (view == nullptr) {
+    // concurrent queries may each build a view, the first one to be published is kept
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    sorted_view_ = new (AllocSortedView(allocator_).allocate(1)) quantiles_sorted_view<T, C, A>(get_sorted_view());
+    AllocSortedView alloc(allocator_);
+    quantiles_sorted_view<T, C, A> built = get_sorted_view();
+    view = new (alloc.allocate(1)) quantiles_sorted_view<T, C, A>(std::move(built));
+    quantiles_sorted_view<T, C, A>* published = nullptr;
+    if (!sorted_view_.compare_exchange_strong(published, view, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      view->~quantiles_sorted_view();
+      alloc.deallocate(view, 1);
+      view = published;
+    }
   }
+  return *view;
 }
 
 template<typename T, typename C, typename A>
 void kll_sketch<T, C, A>::reset_sorted_view() {
-  if (sorted_view_ != nullptr) {
-    sorted_view_->~quantiles_sorted_view();
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.exchange(nullptr);
+  if (view != nullptr) {
+    view->~quantiles_sorted_view();
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    AllocSortedView(allocator_).deallocate(sorted_view_, 1);
-    sorted_view_ = nullptr;
+    AllocSortedView(allocator_).deallocate(view, 1);
   }
 }
 
+// kll_sketch::merge_buffers implementation
+
+template<typename T, typename C, typename A>
+kll_sketch<T, C, A>::merge_buffers::merge_buffers(const A& allocator):
+worklevels(allocator),
+outlevels(allocator),
+allocator_(allocator),
+items_(nullptr),
+capacity_(0)
+{}
+
+template<typename T, typename C, typename A>
+kll_sketch<T, C, A>::merge_buffers::~merge_buffers() {
+  if (items_ != nullptr) allocator_.deallocate(items_, capacity_);
+}
+
+template<typename T, typename C, typename A>
+T* kll_sketch<T, C, A>::merge_buffers::get_items(uint32_t size) {
+  if (size > capacity_) {
+    if (items_ != nullptr) allocator_.deallocate(items_, capacity_);
+    items_ = nullptr; // in case allocation throws
+    capacity_ = 0;
+    items_ = allocator_.allocate(size);
+    capacity_ = size;
+  }
+  return items_;
+}
+
 // kll_sketch::const_iterator implementation
 
 template<typename T, typename C, typename A>
@@ -1114,6 +1383,345 @@ auto kll_sketch<T, C, A>::const_iterator::operator->() const -> const return_val
   return **this;
 }
 
+// wrapped sketch
+
+template<typename T, typename C, typename A>
+wrapped_kll_sketch<T, C, A>::wrapped_kll_sketch(const C& comparator, const A& allocator):
+comparator_(comparator),
+allocator_(allocator),
+k_(0),
+m_(0),
+min_k_(0),
+num_levels_(1),
+is_level_zero_sorted_(false),
+n_(0),
+levels_(nullptr, 1, 0, 0),
+items_(),
+min_item_(),
+max_item_(),
+sorted_level_zero_(allocator)
+{}
+
+template<typename T, typename C, typename A>
+wrapped_kll_sketch<T, C, A> wrapped_kll_sketch<T, C, A>::wrap(const void* bytes, size_t size, const C& comparator, const A& allocator) {
+  using sketch = kll_sketch<T, C, A>;
+  ensure_minimum_memory(size, 8);
+  const char* ptr = static_cast<const char*>(bytes);
+  uint8_t preamble_ints;
+  ptr += copy_from_mem(ptr, preamble_ints);
+  uint8_t serial_version;
+  ptr += copy_from_mem(ptr, serial_version);
+  uint8_t family_id;
+  ptr += copy_from_mem(ptr, family_id);
+  uint8_t flags_byte;
+  ptr += copy_from_mem(ptr, flags_byte);
+  uint16_t k;
+  ptr += copy_from_mem(ptr, k);
+  uint8_t m;
+  ptr += copy_from_mem(ptr, m);
+  ptr += sizeof(uint8_t); // skip unused byte
+
+  sketch::check_m(m);
+  sketch::check_preamble_ints(preamble_ints, flags_byte);
+  sketch::check_serial_version(serial_version);
+  sketch::check_family_id(family_id);
+  ensure_minimum_memory(size, preamble_ints * sizeof(uint32_t));
+
+  wrapped_kll_sketch view(comparator, allocator);
+  view.k_ = k;
+  view.m_ = m;
+  view.min_k_ = k;
+  const bool is_empty(flags_byte & (1 << sketch::flags::IS_EMPTY));
+  if (is_empty) return view;
+
+  const bool is_single_item(flags_byte & (1 << sketch::flags::IS_SINGLE_ITEM)); // used in serial version 2
+  const char* levels_ptr = nullptr;
+  if (is_single_item) {
+    view.n_ = 1;
+  } else {
+    ptr += copy_from_mem(ptr, view.n_);
+    ptr += copy_from_mem(ptr, view.min_k_);
+    ptr += copy_from_mem(ptr, view.num_levels_);
+    ptr += sizeof(uint8_t); // skip unused byte
+    if (view.num_levels_ == 0) throw std::invalid_argument("Possible corruption: zero levels");
+    ensure_minimum_memory(size, sketch::DATA_START + view.num_levels_ * sizeof(uint32_t));
+    levels_ptr = ptr;
+    ptr += view.num_levels_ * sizeof(uint32_t);
+  }
+  const uint32_t capacity = kll_helper::compute_total_capacity(k, m, view.num_levels_);
+
+  // unlike deserialize(), the items are read in place, so the levels must be checked to stay within the image
+  uint32_t level_zero_start = capacity - 1;
+  if (!is_single_item) {
+    copy_from_mem(levels_ptr, level_zero_start);
+    uint32_t previous = level_zero_start;
+    for (uint8_t level = 1; level < view.num_levels_; ++level) {
+      uint32_t current;
+      copy_from_mem(levels_ptr + level * sizeof(uint32_t), current);
+      if (current < previous) throw std::invalid_argument("Possible corruption: levels must not decrease");
+      previous = current;
+    }
+    if (previous > capacity) throw std::invalid_argument("Possible corruption: levels exceed capacity");
+  }
+  view.levels_ = levels_reader(levels_ptr, view.num_levels_, level_zero_start, capacity);
+
+  if (!is_single_item) {
+    ensure_minimum_memory(size, (ptr - static_cast<const char*>(bytes)) + 2 * sizeof(T));
+    view.min_item_ = item_reader(ptr);
+    ptr += sizeof(T);
+    view.max_item_ = item_reader(ptr);
+    ptr += sizeof(T);
+  }
+  const uint32_t num_items = capacity - level_zero_start;
+  const size_t expected_size = (ptr - static_cast<const char*>(bytes)) + num_items * sizeof(T);
+  ensure_minimum_memory(size, expected_size);
+  if (expected_size != size) throw std::logic_error("deserialized size mismatch: " + std::to_string(expected_size) + " != " + std::to_string(size));
+  view.items_ = item_reader(ptr);
+  if (is_single_item) {
+    view.min_item_ = view.items_;
+    view.max_item_ = view.items_;
+  }
+  view.is_level_zero_sorted_ = (flags_byte & (1 << sketch::flags::IS_LEVEL_ZERO_SORTED)) > 0;
+
+  // a sorted copy of level zero is small and makes all levels searchable by every query
+  if (!view.is_level_zero_sorted_) {
+    const uint32_t level_zero_size = view.levels_[1];
+    view.sorted_level_zero_.reserve(level_zero_size);
+    for (uint32_t i = 0; i < level_zero_size; ++i) view.sorted_level_zero_.push_back(view.items_[i]);
+    sort_utils::sort(view.sorted_level_zero_.data(), view.sorted_level_zero_.data() + level_zero_size, view.comparator_, view.allocator_);
+  }
+  return view;
+}
+
+template<typename T, typename C, typename A>
+bool wrapped_kll_sketch<T, C, A>::is_empty() const {
+  return n_ == 0;
+}
+
+template<typename T, typename C, typename A>
+uint16_t wrapped_kll_sketch<T, C, A>::get_k() const {
+  return k_;
+}
+
+template<typename T, typename C, typename A>
+uint64_t wrapped_kll_sketch<T, C, A>::get_n() const {
+  return n_;
+}
+
+template<typename T, typename C, typename A>
+uint32_t wrapped_kll_sketch<T, C, A>::get_num_retained() const {
+  return levels_[num_levels_] - levels_[0];
+}
+
+template<typename T, typename C, typename A>
+bool wrapped_kll_sketch<T, C, A>::is_estimation_mode() const {
+  return num_levels_ > 1;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::get_min_item() const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return *min_item_;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::get_max_item() const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return *max_item_;
+}
+
+template<typename T, typename C, typename A>
+double wrapped_kll_sketch<T, C, A>::get_rank(const T& item, bool inclusive) const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return static_cast<double>(get_weight(item, inclusive)) / n_;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::get_quantile(double rank, bool inclusive) const {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  if ((rank < 0.0) || (rank > 1.0)) {
+    throw std::invalid_argument("normalized rank cannot be less than zero or greater than 1.0");
+  }
+  const uint64_t weight = inclusive ? std::ceil(rank * n_) : rank * n_;
+  const T* sorted_level_zero = has_sorted_copy() ? sorted_level_zero_.data() : nullptr;
+
+  // In the sorted view the quantile is the first entry with enough cumulative weight,
+  // which is the least retained item with enough weight of items not greater than it.
+  // Each level is sorted, so the least such item of each level is found by binary search.
+  auto below = [this, weight, inclusive](const T& item) {
+    const uint64_t item_weight = get_weight(item, true);
+    return inclusive ? item_weight < weight : item_weight <= weight;
+  };
+  bool found = false;
+  T quantile = T();
+  T max_retained_item = T();
+  for (uint8_t level = 0; level < num_levels_; ++level) {
+    const uint32_t first = levels_[level];
+    const uint32_t last = levels_[level + 1];
+    if (first == last) continue;
+    T candidate;
+    T last_item;
+    bool has_candidate;
+    if (level == 0 && sorted_level_zero != nullptr) {
+      const uint32_t index = partition_point(sorted_level_zero, 0, last - first, below);
+      has_candidate = index < last - first;
+      if (has_candidate) candidate = sorted_level_zero[index];
+      last_item = sorted_level_zero[last - first - 1];
+    } else {
+      const uint32_t index = partition_point(items_, first, last, below);
+      has_candidate = index < last;
+      if (has_candidate) candidate = items_[index];
+      last_item = items_[last - 1];
+    }
+    if (has_candidate && (!found || comparator_(candidate, quantile))) {
+      quantile = candidate;
+      found = true;
+    }
+    if (level == 0 || comparator_(max_retained_item, last_item)) max_retained_item = last_item;
+  }
+  // past the end means the last item, as in the sorted view
+  return found ? quantile : max_retained_item;
+}
+
+template<typename T, typename C, typename A>
+auto wrapped_kll_sketch<T, C, A>::get_PMF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
+  auto buckets = get_CDF(split_points, size, inclusive);
+  for (uint32_t i = size; i > 0; --i) {
+    buckets[i] -= buckets[i - 1];
+  }
+  return buckets;
+}
+
+template<typename T, typename C, typename A>
+auto wrapped_kll_sketch<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  quantiles_sorted_view<T, C, A>::check_split_points(split_points, size);
+  vector_double buckets(allocator_);
+  buckets.reserve(size + 1);
+  for (uint32_t i = 0; i < size; ++i) {
+    buckets.push_back(static_cast<double>(get_weight(split_points[i], inclusive)) / n_);
+  }
+  buckets.push_back(1);
+  return buckets;
+}
+
+template<typename T, typename C, typename A>
+double wrapped_kll_sketch<T, C, A>::get_normalized_rank_error(bool pmf) const {
+  return kll_sketch<T, C, A>::get_normalized_rank_error(min_k_, pmf);
+}
+
+template<typename T, typename C, typename A>
+uint8_t wrapped_kll_sketch<T, C, A>::get_m() const {
+  return m_;
+}
+
+template<typename T, typename C, typename A>
+uint16_t wrapped_kll_sketch<T, C, A>::get_min_k() const {
+  return min_k_;
+}
+
+template<typename T, typename C, typename A>
+uint8_t wrapped_kll_sketch<T, C, A>::get_num_levels() const {
+  return num_levels_;
+}
+
+template<typename T, typename C, typename A>
+auto wrapped_kll_sketch<T, C, A>::get_levels() const -> const levels_reader& {
+  return levels_;
+}
+
+template<typename T, typename C, typename A>
+auto wrapped_kll_sketch<T, C, A>::get_items() const -> const item_reader& {
+  return items_;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::stored_min_item() const {
+  return *min_item_;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::stored_max_item() const {
+  return *max_item_;
+}
+
+template<typename T, typename C, typename A>
+bool wrapped_kll_sketch<T, C, A>::has_sorted_copy() const {
+  return !is_level_zero_sorted_;
+}
+
+template<typename T, typename C, typename A>
+uint32_t wrapped_kll_sketch<T, C, A>::safe_level_size(uint8_t level) const {
+  if (level >= num_levels_) return 0;
+  return levels_[level + 1] - levels_[level];
+}
+
+template<typename T, typename C, typename A>
+uint32_t wrapped_kll_sketch<T, C, A>::get_num_retained_above_level_zero() const {
+  if (num_levels_ == 1) return 0;
+  return levels_[num_levels_] - levels_[1];
+}
+
+template<typename T, typename C, typename A>
+uint64_t wrapped_kll_sketch<T, C, A>::get_weight(const T& item, bool inclusive) const {
+  const C& comparator = comparator_;
+  auto before = [&comparator, &item, inclusive](const T& other) {
+    return inclusive ? !comparator(item, other) : comparator(other, item);
+  };
+  uint64_t weight = 0;
+  for (uint8_t level = 0; level < num_levels_; ++level) {
+    const uint32_t first = levels_[level];
+    const uint32_t last = levels_[level + 1];
+    uint32_t count = 0;
+    if (level == 0 && has_sorted_copy()) {
+      count = partition_point(sorted_level_zero_.data(), 0, last - first, before);
+    } else {
+      count = partition_point(items_, first, last, before) - first;
+    }
+    weight += static_cast<uint64_t>(count) << level;
+  }
+  return weight;
+}
+
+template<typename T, typename C, typename A>
+template<typename Items, typename Predicate>
+uint32_t wrapped_kll_sketch<T, C, A>::partition_point(const Items& items, uint32_t first, uint32_t last, Predicate pred) {
+  while (first < last) {
+    const uint32_t middle = first + (last - first) / 2;
+    if (pred(items[middle])) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+template<typename T, typename C, typename A>
+T wrapped_kll_sketch<T, C, A>::item_reader::operator[](uint32_t index) const {
+  T item;
+  copy_from_mem(ptr_ + index * sizeof(T), item);
+  return item;
+}
+
+template<typename T, typename C, typename A>
+wrapped_kll_sketch<T, C, A>::levels_reader::levels_reader(const char* ptr, uint8_t num_levels, uint32_t offset, uint32_t capacity):
+ptr_(ptr),
+num_levels_(num_levels),
+offset_(offset),
+capacity_(capacity)
+{}
+
+template<typename T, typename C, typename A>
+uint32_t wrapped_kll_sketch<T, C, A>::levels_reader::operator[](uint8_t level) const {
+  // the last integer is not serialized because it can be derived
+  if (level == num_levels_) return capacity_ - offset_;
+  if (ptr_ == nullptr) return 0; // single item
+  uint32_t value;
+  copy_from_mem(ptr_ + level * sizeof(uint32_t), value);
+  return value - offset_;
+}
+
 } /* namespace datasketches */
 
 #endif
@@ -23,6 +23,12 @@
 #include <sstream>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
 
 #include <kll_sketch.hpp>
 #include <test_allocator.hpp>
@@ -72,6 +78,7 @@ TEST_CASE("kll sketch", "[kll_sketch]") {
     const float split_points[1] {0};
     REQUIRE_THROWS_AS(sketch.get_PMF(split_points, 1), std::runtime_error);
     REQUIRE_THROWS_AS(sketch.get_CDF(split_points, 1), std::runtime_error);
+    REQUIRE_THROWS_AS(sketch.get_ranks(split_points, 1), std::runtime_error);
 
     for (auto pair: sketch) {
       unused(pair); // to suppress "unused" warning
@@ -264,6 +271,26 @@ TEST_CASE("kll sketch", "[kll_sketch]") {
     }
   }
 
+  SECTION("batch ranks and quantiles") {
+    kll_float_sketch sketch(200, std::less<float>(), 0);
+    const int n = 10000;
+    for (int i = 0; i < n; i++) sketch.update(static_cast<float>(i));
+    std::vector<float> items;
+    for (int i = -1; i <= n; i += 3) items.push_back(static_cast<float>(i));
+    std::vector<float> shuffled(items.rbegin(), items.rend());
+    std::swap(shuffled[0], shuffled[shuffled.size() / 2]);
+    std::vector<double> ranks;
+    for (int i = 0; i <= 100; i++) ranks.push_back(i / 100.0);
+    for (bool inclusive: {true, false}) {
+      for (const auto& batch: {items, shuffled}) {
+        const auto batch_ranks = sketch.get_ranks(batch.data(), static_cast<uint32_t>(batch.size()), inclusive);
+        for (size_t i = 0; i < batch.size(); i++) REQUIRE(batch_ranks[i] == sketch.get_rank(batch[i], inclusive));
+      }
+      const auto quantiles = sketch.get_quantiles(ranks.data(), static_cast<uint32_t>(ranks.size()), inclusive);
+      for (size_t i = 0; i < ranks.size(); i++) REQUIRE(quantiles[i] == sketch.get_quantile(ranks[i], inclusive));
+    }
+  }
+
   SECTION("deserialize from java") {
     std::ifstream is;
     is.exceptions(std::ios::failbit | std::ios::badbit);
@@ -800,6 +827,39 @@ TEST_CASE("kll sketch", "[kll_sketch]") {
     }
   }
 
+  SECTION("bulk update") {
+    std::vector<float> values;
+    for (int i = 0; i < 10000; i++) values.push_back(static_cast<float>((i * 7919) % 10000));
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+    kll_float_sketch sketch1(200, std::less<float>(), 0);
+    kll_float_sketch sketch2(200, std::less<float>(), 0);
+    for (size_t i = 0; i < values.size(); i += 1000) {
+      const size_t end = std::min(i + 1000, values.size());
+      for (size_t j = i; j < end; j++) sketch1.update(values[j]);
+      if (!sketch2.is_empty()) sketch2.get_rank(0); // make sure the cached sorted view is dropped
+      sketch2.update(values.data() + i, values.data() + end);
+    }
+    REQUIRE(sketch2.get_n() == 10000);
+    REQUIRE(sketch2.get_n() == sketch1.get_n());
+    REQUIRE(sketch2.get_num_retained() == sketch1.get_num_retained());
+    REQUIRE(sketch2.get_min_item() == 0);
+    REQUIRE(sketch2.get_max_item() == 9999);
+    REQUIRE(sketch2.get_rank(5000) == Approx(0.5).margin(RANK_EPS_FOR_K_200));
+    REQUIRE(sketch2.get_quantile(0.5) == Approx(5000).margin(10000 * RANK_EPS_FOR_K_200));
+    sketch2.update(values.data(), values.data());
+    REQUIRE(sketch2.get_n() == 10000);
+  }
+
+  SECTION("bulk update below k") {
+    const std::vector<std::string> values {"c", "a", "d", "b"};
+    kll_string_sketch sketch(200, std::less<std::string>(), 0);
+    sketch.update(values.begin(), values.end());
+    REQUIRE(sketch.get_n() == 4);
+    REQUIRE(sketch.get_min_item() == "a");
+    REQUIRE(sketch.get_max_item() == "d");
+    REQUIRE(sketch.get_quantile(0.5) == "b");
+  }
+
   SECTION("type conversion: empty") {
     kll_sketch<double> kll_double;
     kll_sketch<float> kll_float(kll_double);
@@ -866,8 +926,374 @@ TEST_CASE("kll sketch", "[kll_sketch]") {
     REQUIRE(sb.get_n() == 3);
   }
 
+  SECTION("reproducible with a given seed") {
+    auto build = []() {
+      random_utils::override_seed(42);
+      kll_float_sketch sketch(200, std::less<float>(), 0);
+      for (int i = 0; i < 100000; i++) sketch.update(static_cast<float>(i));
+      return sketch.serialize();
+    };
+    const auto bytes1 = build();
+    const auto bytes2 = build();
+    REQUIRE(bytes1 == bytes2);
+    random_utils::reset_seed();
+  }
+
   // cleanup
   REQUIRE(test_allocator_total_bytes == 0);
 }
 
+TEST_CASE("kll sketch: merge range", "[kll_sketch]") {
+  const int num_sketches = 100;
+  const int n = 2000;
+  const uint64_t total = num_sketches * n;
+  std::vector<kll_sketch<float>> sketches;
+  for (int s = 0; s < num_sketches; ++s) {
+    sketches.emplace_back();
+    for (int i = 0; i < n; ++i) sketches.back().update(static_cast<float>(i * num_sketches + s));
+  }
+  sketches.emplace_back(); // empty
+
+  for (unsigned num_threads: {1, 3, 8, 1000}) {
+    kll_sketch<float> sketch;
+    sketch.update(0.5f);
+    sketch.merge(sketches.begin(), sketches.end(), num_threads);
+    REQUIRE(sketch.get_n() == total + 1);
+    REQUIRE(sketch.get_min_item() == 0);
+    REQUIRE(sketch.get_max_item() == total - 1);
+    for (int i = 1; i < 10; ++i) {
+      REQUIRE(sketch.get_rank(static_cast<float>(total * i / 10)) == Approx(i / 10.0).margin(RANK_EPS_FOR_K_200));
+    }
+  }
+
+  SECTION("type conversion") {
+    kll_sketch<double> sketch;
+    sketch.merge(sketches.begin(), sketches.end(), 4);
+    REQUIRE(sketch.get_n() == total);
+    REQUIRE(sketch.get_max_item() == total - 1);
+  }
+
+  SECTION("wrapped sketches") {
+    std::vector<std::vector<uint8_t, std::allocator<uint8_t>>> images;
+    std::vector<wrapped_kll_sketch<float>> views;
+    for (const auto& s: sketches) images.push_back(s.serialize());
+    for (const auto& image: images) views.push_back(wrapped_kll_sketch<float>::wrap(image.data(), image.size()));
+    kll_sketch<float> sketch;
+    sketch.merge(views.begin(), views.end(), 4);
+    REQUIRE(sketch.get_n() == total);
+    REQUIRE(sketch.get_rank(static_cast<float>(total / 2)) == Approx(0.5).margin(RANK_EPS_FOR_K_200));
+  }
+
+  SECTION("empty range") {
+    kll_sketch<float> sketch;
+    sketch.merge(sketches.end(), sketches.end(), 4);
+    REQUIRE(sketch.is_empty());
+  }
+}
+
+template<typename T>
+static void check_wrapped(const kll_sketch<T>& sketch) {
+  auto bytes = sketch.serialize();
+  // shift the image by one byte to make items unaligned
+  std::unique_ptr<char[]> unaligned(new char[bytes.size() + 1]);
+  std::memcpy(unaligned.get() + 1, bytes.data(), bytes.size());
+  const auto view = wrapped_kll_sketch<T>::wrap(unaligned.get() + 1, bytes.size());
+  const auto deserialized = kll_sketch<T>::deserialize(bytes.data(), bytes.size());
+  REQUIRE(view.get_k() == deserialized.get_k());
+  REQUIRE(view.get_n() == deserialized.get_n());
+  REQUIRE(view.get_num_retained() == deserialized.get_num_retained());
+  REQUIRE(view.is_estimation_mode() == deserialized.is_estimation_mode());
+  REQUIRE(view.get_normalized_rank_error(false) == deserialized.get_normalized_rank_error(false));
+  REQUIRE(view.get_min_item() == deserialized.get_min_item());
+  REQUIRE(view.get_max_item() == deserialized.get_max_item());
+  std::vector<T> split_points;
+  for (int i = -1; i <= static_cast<int>(view.get_n()); i += 1 + static_cast<int>(view.get_n() / 50)) {
+    split_points.push_back(static_cast<T>(i));
+  }
+  for (bool inclusive: {true, false}) {
+    for (T item: split_points) REQUIRE(view.get_rank(item, inclusive) == deserialized.get_rank(item, inclusive));
+    for (int i = 0; i <= 100; ++i) {
+      const double rank = i / 100.0;
+      REQUIRE(view.get_quantile(rank, inclusive) == deserialized.get_quantile(rank, inclusive));
+    }
+    const uint32_t size = static_cast<uint32_t>(split_points.size());
+    REQUIRE(view.get_CDF(split_points.data(), size, inclusive) == deserialized.get_CDF(split_points.data(), size, inclusive));
+    const auto pmf1 = view.get_PMF(split_points.data(), size, inclusive);
+    const auto pmf2 = deserialized.get_PMF(split_points.data(), size, inclusive);
+    REQUIRE(pmf1.size() == pmf2.size());
+    for (size_t i = 0; i < pmf1.size(); ++i) REQUIRE(pmf1[i] == Approx(pmf2[i]).margin(NUMERIC_NOISE_TOLERANCE));
+  }
+
+  // merging the view must give the same result as merging the deserialized sketch
+  kll_sketch<T> target(100);
+  for (int i = 0; i < 1000; ++i) target.update(static_cast<T>(i * 7 % 1000));
+  kll_sketch<T> merged1(target);
+  kll_sketch<T> merged2(target);
+  random_utils::override_seed(1);
+  merged1.merge(kll_sketch<T>::deserialize(bytes.data(), bytes.size()));
+  random_utils::override_seed(1);
+  merged2.merge(view);
+  REQUIRE(merged1.serialize() == merged2.serialize());
+  random_utils::reset_seed();
+}
+
+TEST_CASE("wrapped kll sketch", "[kll_sketch]") {
+  SECTION("empty") {
+    kll_sketch<float> sketch;
+    auto bytes = sketch.serialize();
+    const auto view = wrapped_kll_sketch<float>::wrap(bytes.data(), bytes.size());
+    REQUIRE(view.is_empty());
+    REQUIRE(view.get_n() == 0);
+    REQUIRE(view.get_num_retained() == 0);
+    REQUIRE_THROWS_AS(view.get_min_item(), std::runtime_error);
+    REQUIRE_THROWS_AS(view.get_rank(0), std::runtime_error);
+    REQUIRE_THROWS_AS(view.get_quantile(0.5), std::runtime_error);
+    kll_sketch<float> target;
+    target.update(1);
+    target.merge(view);
+    REQUIRE(target.get_n() == 1);
+  }
+
+  SECTION("float and double") {
+    for (int n: {1, 2, 10, 1000, 100000}) {
+      kll_sketch<float> float_sketch;
+      kll_sketch<double> double_sketch;
+      for (int i = 0; i < n; ++i) {
+        float_sketch.update(static_cast<float>((i * 31) % n));
+        double_sketch.update(static_cast<double>((i * 31) % n));
+      }
+      check_wrapped(float_sketch);
+      check_wrapped(double_sketch);
+    }
+  }
+
+  SECTION("single item v1") {
+    std::ifstream is;
+    is.exceptions(std::ios::failbit | std::ios::badbit);
+    is.open(testBinaryInputPath + "kll_sketch_float_one_item_v1.sk", std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    const auto view = wrapped_kll_sketch<float>::wrap(bytes.data(), bytes.size());
+    REQUIRE(view.get_n() == 1);
+    REQUIRE(view.get_min_item() == 1);
+    REQUIRE(view.get_quantile(0.5) == 1);
+  }
+
+  SECTION("corrupt") {
+    kll_sketch<float> sketch;
+    for (int i = 0; i < 1000; ++i) sketch.update(static_cast<float>(i));
+    auto bytes = sketch.serialize();
+    REQUIRE_THROWS_AS(wrapped_kll_sketch<float>::wrap(bytes.data(), bytes.size() - 1), std::out_of_range);
+    REQUIRE_THROWS_AS(wrapped_kll_sketch<float>::wrap(bytes.data(), bytes.size() + 1), std::logic_error);
+    bytes[20] = 0xff; // first level beyond capacity
+    REQUIRE_THROWS_AS(wrapped_kll_sketch<float>::wrap(bytes.data(), bytes.size()), std::invalid_argument);
+  }
+}
+
+TEST_CASE("kll sketch: freeze", "[kll_sketch]") {
+  SECTION("empty") {
+    kll_float_sketch sketch(200, std::less<float>(), 0);
+    const auto snapshot = sketch.freeze();
+    REQUIRE(snapshot.is_empty());
+    REQUIRE(snapshot.get_n() == 0);
+    REQUIRE(snapshot.get_num_retained() == 0);
+    REQUIRE_THROWS_AS(snapshot.get_min_item(), std::runtime_error);
+    REQUIRE_THROWS_AS(snapshot.get_rank(0), std::runtime_error);
+    REQUIRE_THROWS_AS(snapshot.get_quantile(0.5), std::runtime_error);
+  }
+
+  SECTION("same results as the sketch") {
+    kll_float_sketch sketch(200, std::less<float>(), 0);
+    const int n = 10000;
+    for (int i = 0; i < n; i++) sketch.update(static_cast<float>(i));
+    const auto snapshot = sketch.freeze();
+    REQUIRE(snapshot.get_n() == sketch.get_n());
+    REQUIRE(snapshot.get_num_retained() == sketch.get_num_retained());
+    REQUIRE(snapshot.get_min_item() == sketch.get_min_item());
+    REQUIRE(snapshot.get_max_item() == sketch.get_max_item());
+    for (int i = 0; i < n; i += 100) {
+      const float item = static_cast<float>(i);
+      REQUIRE(snapshot.get_rank(item) == sketch.get_rank(item));
+      REQUIRE(snapshot.get_rank(item, false) == sketch.get_rank(item, false));
+    }
+    for (int i = 0; i <= 100; i++) {
+      const double rank = i / 100.0;
+      REQUIRE(snapshot.get_quantile(rank) == sketch.get_quantile(rank));
+      REQUIRE(snapshot.get_quantile(rank, false) == sketch.get_quantile(rank, false));
+    }
+    const float split_points[3] {1000, 5000, 9000};
+    REQUIRE(snapshot.get_CDF(split_points, 3) == sketch.get_CDF(split_points, 3));
+    REQUIRE(snapshot.get_PMF(split_points, 3) == sketch.get_PMF(split_points, 3));
+    REQUIRE_THROWS_AS(snapshot.get_quantile(-1), std::invalid_argument);
+    REQUIRE_THROWS_AS(snapshot.get_quantile(2), std::invalid_argument);
+
+    // not affected by later updates
+    const double rank = snapshot.get_rank(5000);
+    for (int i = 0; i < n; i++) sketch.update(0);
+    REQUIRE(snapshot.get_n() == static_cast<uint64_t>(n));
+    REQUIRE(snapshot.get_rank(5000) == rank);
+  }
+
+  SECTION("outlives the sketch") {
+    kll_string_sketch sketch(200, std::less<std::string>(), 0);
+    for (int i = 0; i < 1000; i++) sketch.update(std::to_string(i));
+    const auto ranks_before_freeze = sketch.get_CDF(std::vector<std::string>({"2", "5"}).data(), 2);
+    const std::string median = sketch.get_quantile(0.5);
+    std::unique_ptr<quantiles_snapshot<std::string, std::less<std::string>, test_allocator<std::string>>> copy;
+    {
+      const auto snapshot = sketch.freeze();
+      sketch = kll_string_sketch(200, std::less<std::string>(), 0);
+      copy.reset(new quantiles_snapshot<std::string, std::less<std::string>, test_allocator<std::string>>(snapshot));
+      REQUIRE(snapshot.get_min_item() == "0");
+    }
+    REQUIRE(copy->get_n() == 1000);
+    REQUIRE(copy->get_min_item() == "0");
+    REQUIRE(copy->get_max_item() == "999");
+    REQUIRE(copy->get_CDF(std::vector<std::string>({"2", "5"}).data(), 2) == ranks_before_freeze);
+    REQUIRE(copy->get_quantile(0.5) == median);
+  }
+}
+
+TEST_CASE("kll sketch: concurrent queries", "[kll_sketch]") {
+  // test_allocator is not thread-safe, so the default allocator is used here
+  kll_sketch<float> sketch;
+  const int n = 100000;
+  for (int i = 0; i < n; i++) sketch.update(static_cast<float>(i));
+  const kll_sketch<float> reference(sketch);
+  std::vector<double> expected_ranks;
+  std::vector<float> expected_quantiles;
+  for (int i = 0; i < n; i += 1000) {
+    expected_ranks.push_back(reference.get_rank(static_cast<float>(i)));
+    expected_quantiles.push_back(reference.get_quantile(expected_ranks.back()));
+  }
+
+  const unsigned num_threads = 4;
+  std::vector<int> mismatches(num_threads, 0);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < num_threads; t++) {
+    threads.emplace_back([&sketch, &expected_ranks, &expected_quantiles, &mismatches, t]() {
+      // the first queries race to build the sorted view
+      for (size_t j = 0; j < expected_ranks.size(); j++) {
+        if (sketch.get_rank(static_cast<float>(j * 1000)) != expected_ranks[j]) mismatches[t]++;
+        if (sketch.get_quantile(expected_ranks[j]) != expected_quantiles[j]) mismatches[t]++;
+      }
+    });
+  }
+  for (auto& thread: threads) thread.join();
+  for (unsigned t = 0; t < num_threads; t++) REQUIRE(mismatches[t] == 0);
+}
+
+// counts allocations of arrays of float items to check that reserved space is used
+static unsigned counting_allocator_calls = 0;
+
+template<typename T>
+struct counting_allocator: std::allocator<T> {
+  using value_type = T;
+  template<typename U> struct rebind { using other = counting_allocator<U>; };
+  counting_allocator() = default;
+  template<typename U> counting_allocator(const counting_allocator<U>&) {}
+  T* allocate(size_t n) {
+    if (std::is_same<T, float>::value && n > 1) ++counting_allocator_calls;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
+TEST_CASE("kll sketch: reserve", "[kll_sketch]") {
+  const int n = 1000000;
+
+  SECTION("same serialized form") {
+    random_utils::override_seed(1);
+    kll_float_sketch sketch1(200, std::less<float>(), 0);
+    for (int i = 0; i < n; i++) sketch1.update(static_cast<float>(i));
+    random_utils::override_seed(1);
+    kll_float_sketch sketch2(200, std::less<float>(), 0, n);
+    for (int i = 0; i < n; i++) sketch2.update(static_cast<float>(i));
+    random_utils::override_seed(1);
+    kll_float_sketch sketch3(200, std::less<float>(), 0);
+    for (int i = 0; i < n; i++) {
+      if (i == 1000) sketch3.reserve(n);
+      sketch3.update(static_cast<float>(i));
+    }
+    REQUIRE(sketch2.serialize() == sketch1.serialize());
+    REQUIRE(sketch3.serialize() == sketch1.serialize());
+
+    // copies do not keep the reserved space
+    kll_float_sketch sketch4(sketch2);
+    REQUIRE(sketch4.serialize() == sketch1.serialize());
+    random_utils::reset_seed();
+  }
+
+  SECTION("no reallocation while updating") {
+    using sketch_type = kll_sketch<float, std::less<float>, counting_allocator<float>>;
+    sketch_type sketch(200, std::less<float>(), counting_allocator<float>(), n);
+    counting_allocator_calls = 0;
+    for (int i = 0; i < n; i++) sketch.update(static_cast<float>(i));
+    REQUIRE(counting_allocator_calls == 0);
+
+    sketch_type sketch2;
+    counting_allocator_calls = 0;
+    for (int i = 0; i < n; i++) sketch2.update(static_cast<float>(i));
+    REQUIRE(counting_allocator_calls > 1);
+    REQUIRE(counting_allocator_calls < 6); // growth by more than one level at a time
+  }
+
+  SECTION("merges with reused buffers") {
+    std::vector<kll_float_sketch> sketches;
+    for (int s = 0; s < 10; s++) {
+      sketches.emplace_back(200, std::less<float>(), 0);
+      for (int i = 0; i < 10000; i++) sketches.back().update(static_cast<float>(i * 10 + s));
+    }
+    random_utils::override_seed(1);
+    kll_float_sketch merged1(200, std::less<float>(), 0);
+    for (const auto& sketch: sketches) merged1.merge(sketch);
+    random_utils::override_seed(1);
+    kll_float_sketch merged2(200, std::less<float>(), 0, 100000);
+    kll_float_sketch::merge_buffers buffers(0);
+    for (const auto& sketch: sketches) merged2.merge(sketch, buffers);
+    REQUIRE(merged2.serialize() == merged1.serialize());
+    random_utils::reset_seed();
+  }
+}
+
+// counts the live instances, the constructors throw once the given number of constructions is reached
+struct throwing_item {
+  static int live;
+  static int constructions_left; // negative for no limit
+  int value;
+  throwing_item(int value): value(value) { construct(); }
+  throwing_item(const throwing_item& other): value(other.value) { construct(); }
+  throwing_item(throwing_item&& other): value(other.value) { construct(); }
+  throwing_item& operator=(const throwing_item& other) = default;
+  throwing_item& operator=(throwing_item&& other) = default;
+  ~throwing_item() { --live; }
+  bool operator<(const throwing_item& other) const { return value < other.value; }
+  static void construct() {
+    if (constructions_left == 0) throw std::runtime_error("throwing_item");
+    if (constructions_left > 0) --constructions_left;
+    ++live;
+  }
+};
+int throwing_item::live = 0;
+int throwing_item::constructions_left = -1;
+
+TEST_CASE("kll sketch: bulk update with items that throw", "[kll_sketch]") {
+  std::vector<throwing_item> items;
+  for (int i = 0; i < 1000; i++) items.push_back(throwing_item(i));
+  const int live = throwing_item::live;
+
+  // the constructions fail after 0, 1, 2... of them until the update completes
+  for (int num = 0; ; ++num) {
+    throwing_item::constructions_left = num;
+    bool thrown = false;
+    try {
+      kll_sketch<throwing_item> sketch(8);
+      sketch.update(items.begin(), items.end());
+    } catch (std::runtime_error&) {
+      thrown = true;
+    }
+    throwing_item::constructions_left = -1;
+    REQUIRE(throwing_item::live == live);
+    if (!thrown) break;
+  }
+}
+
 } /* namespace datasketches */
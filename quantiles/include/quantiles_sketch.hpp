@@ -20,13 +20,17 @@
 #ifndef _QUANTILES_SKETCH_HPP_
 #define _QUANTILES_SKETCH_HPP_
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "quantiles_sorted_view.hpp"
+#include "quantiles_snapshot.hpp"
 #include "common_defs.hpp"
 #include "serde.hpp"
+#include "sort_utils.hpp"
 
 namespace datasketches {
 
@@ -177,6 +181,16 @@ public:
   template<typename FwdT>
   void update(FwdT&& item);
 
+  /**
+   * Updates this sketch with a range of items, such as a contiguous array given by two pointers.
+   * The result is the same as updating with each item in turn, but the base buffer is filled in blocks,
+   * and the minimum and maximum are updated once per block.
+   * @param first iterator to the first item
+   * @param last iterator past the last item
+   */
+  template<typename InputIt>
+  void update(InputIt first, InputIt last);
+
   /**
    * Merges another sketch into this one.
    * @param other sketch to merge into this one
@@ -357,6 +371,22 @@ public:
    */
   vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
 
+  /**
+   * This is a multiple-query version of get_rank().
+   *
+   * <p>If the items are sorted according to the comparator C, they are ranked in one pass
+   * over the sorted view. This is faster than calling get_rank() for each item.
+   *
+   * <p>If the sketch is empty this throws std::runtime_error.
+   *
+   * @param items array of items to be ranked
+   * @param size the number of items in the array
+   * @param inclusive if true the weight of each item is included into its rank
+   *
+   * @return array of approximate normalized ranks of the given items in the same order
+   */
+  vector_double get_ranks(const T* items, uint32_t size, bool inclusive = true) const;
+
   /**
    * Computes size needed to serialize the current state of the sketch.
    * This version is for fixed-size arithmetic types (integral and floating point).
@@ -456,9 +486,17 @@ public:
 
   quantiles_sorted_view<T, Comparator, Allocator> get_sorted_view() const;
 
+  /**
+   * Returns an immutable snapshot of the sketch for queries.
+   * The snapshot has the sorted view built and its own copies of the items,
+   * so it is not affected by later updates and can be queried from many threads at once.
+   * Queries on the sketch itself are also safe to run concurrently as long as nothing modifies the sketch.
+   * @return snapshot for queries
+   */
+  quantiles_snapshot<T, Comparator, Allocator> freeze() const;
+
 private:
   using Level = std::vector<T, Allocator>;
-  using VectorLevels = std::vector<Level, typename std::allocator_traits<Allocator>::template rebind_alloc<Level>>;
 
   /* Serialized sketch layout:
    * Long || Start Byte Addr:
@@ -491,42 +529,73 @@ private:
   uint16_t k_;
   uint64_t n_;
   uint64_t bit_pattern_;
-  Level base_buffer_;
-  VectorLevels levels_;
+  // Base buffer of up to 2k items followed by the levels of k items each in one allocation.
+  // Only the first n mod 2k slots of the base buffer and the levels marked in bit_pattern_ hold items.
+  T* items_;
+  uint32_t items_capacity_;
+  uint8_t num_levels_; // levels allocated in items_
+  // scratch space kept by the sketch, so that carry propagation does not allocate in steady state
+  sort_utils::sort_scratch<T, Allocator> sort_scratch_; // for sorting the full base buffer
+  T* merge_scratch_; // uninitialized space for 3k items, allocated by the first merge into this sketch
   T* min_item_;
   T* max_item_;
-  mutable quantiles_sorted_view<T, Comparator, Allocator>* sorted_view_;
+  mutable std::atomic<quantiles_sorted_view<T, Comparator, Allocator>*> sorted_view_; // built by the first query
 
-  void setup_sorted_view() const; // modifies mutable state
+  const quantiles_sorted_view<T, Comparator, Allocator>& setup_sorted_view() const; // safe for concurrent queries
   void reset_sorted_view();
 
   // for deserialization
   class item_deleter;
   class items_deleter;
-  quantiles_sketch(uint16_t k, uint64_t n, uint64_t bit_pattern,
-      Level&& base_buffer, VectorLevels&& levels,
-      std::unique_ptr<T, item_deleter> min_item, std::unique_ptr<T, item_deleter> max_item,
-      bool is_sorted, const Comparator& comparator = Comparator(), const Allocator& allocator = Allocator());
+  // destroys the items built so far in raw space if building the rest throws
+  class items_guard;
+
+  // an empty sketch with room for the given number of items, filled in by the other constructors
+  quantiles_sketch(uint16_t k, const Comparator& comparator, const Allocator& allocator, uint32_t items_capacity);
+
+  // the start of the given level in items_
+  T* get_level(uint8_t level);
+  const T* get_level(uint8_t level) const;
+
+  // moves the items into a new allocation of the given capacity
+  // num_base_items is passed in since n_ does not tell a full base buffer from an empty one
+  void reallocate_items(uint32_t capacity, uint32_t num_base_items);
 
   void grow_base_buffer();
   void process_full_base_buffer();
+  T* get_merge_scratch();
 
   // returns true if size adjusted, else false
   bool grow_levels_if_needed();
 
-  // buffers should be pre-sized to target capacity as appropriate
-  template<typename FwdV>
-  static void in_place_propagate_carry(uint8_t starting_level, FwdV&& buf_size_k,
-                                       Level& buf_size_2k, bool apply_as_update,
+  // returns the base buffer if sorted, otherwise a sorted copy of it in the given scratch
+  const T* get_sorted_base_buffer(Level& scratch) const;
+
+  // Carries k sorted items into the level starting_level of the sketch, merging with the full levels above it.
+  // In the update version the 2k items of the full base buffer are halved first, and the base buffer
+  // is then used as the scratch space. Otherwise the k items are copied or moved (as FwdSk tells)
+  // from buf_size_k, and buf_size_2k must be uninitialized space for 2k items.
+  // bit_pattern_ marks the levels that hold items at every step, so that an exception leaks none of them.
+  template<typename FwdSk, typename SrcT>
+  static void in_place_propagate_carry(uint8_t starting_level, SrcT* buf_size_k,
+                                       T* buf_size_2k, bool apply_as_update,
                                        quantiles_sketch& sketch);
-  static void zip_buffer(Level& buf_in, Level& buf_out);
-  static void merge_two_size_k_buffers(Level& arr_in_1, Level& arr_in_2, Level& arr_out, const Comparator& comparator);
-
+  // the following construct the output items in uninitialized space, leaving the input items to the caller
+  static void zip_buffer(T* buf_in, T* buf_out, uint16_t k);
+  static void merge_two_size_k_buffers(T* arr_in_1, T* arr_in_2, T* arr_out, uint16_t k, const Comparator& comparator);
+  // arithmetic items go through compaction_kernels, other types are moved one by one
+  static void zip_buffer(T* buf_in, T* buf_out, uint16_t k, uint32_t offset, std::true_type);
+  static void zip_buffer(T* buf_in, T* buf_out, uint16_t k, uint32_t offset, std::false_type);
+  static void merge_two_size_k_buffers(T* arr_in_1, T* arr_in_2, T* arr_out, uint16_t k, const Comparator& comparator, std::true_type);
+  static void merge_two_size_k_buffers(T* arr_in_1, T* arr_in_2, T* arr_out, uint16_t k, const Comparator& comparator, std::false_type);
+  static void destroy_items(T* items, uint32_t num);
+
+  // reads the items of a non-compact base buffer past the retained ones
   template<typename SerDe>
-  static Level deserialize_array(std::istream& is, uint32_t num_items, uint32_t capcacity, const SerDe& serde, const Allocator& allocator);
-  
+  static void skip_items(std::istream& is, uint32_t num_items, const SerDe& serde, const Allocator& allocator);
+
   template<typename SerDe>
-  static std::pair<Level, size_t> deserialize_array(const void* bytes, size_t size, uint32_t num_items, uint32_t capcacity, const SerDe& serde, const Allocator& allocator);
+  static size_t skip_items(const void* bytes, size_t size, uint32_t num_items, const SerDe& serde, const Allocator& allocator);
 
   static void check_k(uint16_t k);
   static void check_serial_version(uint8_t serial_version);
@@ -538,6 +607,8 @@ private:
   static uint64_t compute_bit_pattern(uint16_t k, uint64_t n);
   static uint32_t count_valid_levels(uint64_t bit_pattern);
   static uint8_t compute_levels_needed(uint16_t k, uint64_t n);
+  // room for the base buffer to grow as if the items were added via update()
+  static uint32_t compute_items_capacity(uint16_t k, uint64_t n);
 
  /**
   * Merges the src sketch into the tgt sketch with equal values of K.
@@ -555,8 +626,9 @@ private:
   template<typename FwdSk>
   static void downsampling_merge(quantiles_sketch& tgt, FwdSk&& src);
 
-  template<typename FwdV>
-  static void zip_buffer_with_stride(FwdV&& buf_in, Level& buf_out, uint16_t stride);
+  // takes every stride-th item from stride * k items, the output is constructed in uninitialized space
+  template<typename FwdSk, typename SrcT>
+  static void zip_buffer_with_stride(SrcT* buf_in, T* buf_out, uint16_t k, uint16_t stride);
 
   /**
    * Returns the zero-based bit position of the lowest zero bit of <i>bits</i> starting at
@@ -591,17 +663,14 @@ public:
   const return_value_holder<value_type> operator->() const;
 private:
   friend class quantiles_sketch<T, C, A>;
-  using Level = std::vector<T, A>;
-  using AllocLevel = typename std::allocator_traits<A>::template rebind_alloc<Level>;
-  Level base_buffer_;
-  std::vector<Level, AllocLevel> levels_;
+  const T* items_;
   int level_;
   uint32_t index_;
   uint32_t bb_count_;
   uint64_t bit_pattern_;
   uint64_t weight_;
   uint16_t k_;
-  const_iterator(const Level& base_buffer, const std::vector<Level, AllocLevel>& levels, uint16_t k, uint64_t n, bool is_end);
+  const_iterator(const T* items, uint16_t k, uint64_t n, bool is_end);
 };
 
 } /* namespace datasketches */
@@ -28,48 +28,63 @@
 
 #include "count_zeros.hpp"
 #include "conditional_forward.hpp"
+#include "compaction_kernels.hpp"
+#include "sort_utils.hpp"
 
 namespace datasketches {
 
 template<typename T, typename C, typename A>
 quantiles_sketch<T, C, A>::quantiles_sketch(uint16_t k, const C& comparator, const A& allocator):
+quantiles_sketch(k, comparator, allocator, 2 * std::min(quantiles_constants::MIN_K, k))
+{
+  check_k(k_);
+}
+
+template<typename T, typename C, typename A>
+quantiles_sketch<T, C, A>::quantiles_sketch(uint16_t k, const C& comparator, const A& allocator, uint32_t items_capacity):
 comparator_(comparator),
 allocator_(allocator),
 is_base_buffer_sorted_(true),
 k_(k),
 n_(0),
 bit_pattern_(0),
-base_buffer_(allocator_),
-levels_(allocator_),
+items_(nullptr),
+items_capacity_(items_capacity),
+num_levels_(items_capacity > 2u * k ? static_cast<uint8_t>((items_capacity - 2 * k) / k) : 0),
+sort_scratch_(allocator_),
+merge_scratch_(nullptr),
 min_item_(nullptr),
 max_item_(nullptr),
 sorted_view_(nullptr)
 {
-  check_k(k_);
-  base_buffer_.reserve(2 * std::min(quantiles_constants::MIN_K, k));
+  items_ = allocator_.allocate(items_capacity_);
 }
 
+// the other constructors fill in a constructed sketch, so that its destructor runs if an item throws
+// n_ and bit_pattern_ count only the items built so far, and a level is counted once it is complete
+
 template<typename T, typename C, typename A>
 quantiles_sketch<T, C, A>::quantiles_sketch(const quantiles_sketch& other):
-comparator_(other.comparator_),
-allocator_(other.allocator_),
-is_base_buffer_sorted_(other.is_base_buffer_sorted_),
-k_(other.k_),
-n_(other.n_),
-bit_pattern_(other.bit_pattern_),
-base_buffer_(other.base_buffer_),
-levels_(other.levels_),
-min_item_(nullptr),
-max_item_(nullptr),
-sorted_view_(nullptr)
+quantiles_sketch(other.k_, other.comparator_, other.allocator_, other.items_capacity_)
 {
+  const uint32_t bb_count = compute_base_buffer_items(k_, other.n_);
+  for (uint32_t i = 0; i < bb_count; ++i) {
+    new (&items_[i]) T(other.items_[i]);
+    ++n_;
+  }
+  uint64_t bits = other.bit_pattern_;
+  for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+    if ((bits & 1) == 0) continue;
+    items_guard level(get_level(lvl), 0);
+    const T* other_level = other.get_level(lvl);
+    for (uint16_t i = 0; i < k_; ++i) level.emplace_back(other_level[i]);
+    level.release();
+    bit_pattern_ |= static_cast<uint64_t>(1) << lvl;
+  }
+  n_ = other.n_;
+  is_base_buffer_sorted_ = other.is_base_buffer_sorted_;
   if (other.min_item_ != nullptr) min_item_ = new (allocator_.allocate(1)) T(*other.min_item_);
   if (other.max_item_ != nullptr) max_item_ = new (allocator_.allocate(1)) T(*other.max_item_);
-  for (size_t i = 0; i < levels_.size(); ++i) { 
-    if (levels_[i].capacity() != other.levels_[i].capacity()) {
-      levels_[i].reserve(other.levels_[i].capacity());
-    }
-  }
 }
 
 template<typename T, typename C, typename A>
@@ -80,12 +95,17 @@ is_base_buffer_sorted_(other.is_base_buffer_sorted_),
 k_(other.k_),
 n_(other.n_),
 bit_pattern_(other.bit_pattern_),
-base_buffer_(std::move(other.base_buffer_)),
-levels_(std::move(other.levels_)),
+items_(other.items_),
+items_capacity_(other.items_capacity_),
+num_levels_(other.num_levels_),
+sort_scratch_(std::move(other.sort_scratch_)),
+merge_scratch_(other.merge_scratch_),
 min_item_(other.min_item_),
 max_item_(other.max_item_),
 sorted_view_(nullptr)
 {
+  other.items_ = nullptr;
+  other.merge_scratch_ = nullptr;
   other.min_item_ = nullptr;
   other.max_item_ = nullptr;
 }
@@ -99,8 +119,11 @@ quantiles_sketch<T, C, A>& quantiles_sketch<T, C, A>::operator=(const quantiles_
   std::swap(k_, copy.k_);
   std::swap(n_, copy.n_);
   std::swap(bit_pattern_, copy.bit_pattern_);
-  std::swap(base_buffer_, copy.base_buffer_);
-  std::swap(levels_, copy.levels_);
+  std::swap(items_, copy.items_);
+  std::swap(items_capacity_, copy.items_capacity_);
+  std::swap(num_levels_, copy.num_levels_);
+  std::swap(sort_scratch_, copy.sort_scratch_);
+  std::swap(merge_scratch_, copy.merge_scratch_);
   std::swap(min_item_, copy.min_item_);
   std::swap(max_item_, copy.max_item_);
   reset_sorted_view();
@@ -115,103 +138,68 @@ quantiles_sketch<T, C, A>& quantiles_sketch<T, C, A>::operator=(quantiles_sketch
   std::swap(k_, other.k_);
   std::swap(n_, other.n_);
   std::swap(bit_pattern_, other.bit_pattern_);
-  std::swap(base_buffer_, other.base_buffer_);
-  std::swap(levels_, other.levels_);
+  std::swap(items_, other.items_);
+  std::swap(items_capacity_, other.items_capacity_);
+  std::swap(num_levels_, other.num_levels_);
+  std::swap(sort_scratch_, other.sort_scratch_);
+  std::swap(merge_scratch_, other.merge_scratch_);
   std::swap(min_item_, other.min_item_);
   std::swap(max_item_, other.max_item_);
   reset_sorted_view();
   return *this;
 }
 
-template<typename T, typename C, typename A>
-quantiles_sketch<T, C, A>::quantiles_sketch(uint16_t k, uint64_t n, uint64_t bit_pattern,
-      Level&& base_buffer, VectorLevels&& levels,
-      std::unique_ptr<T, item_deleter> min_item, std::unique_ptr<T, item_deleter> max_item,
-      bool is_sorted, const C& comparator, const A& allocator):
-comparator_(comparator),
-allocator_(allocator),
-is_base_buffer_sorted_(is_sorted),
-k_(k),
-n_(n),
-bit_pattern_(bit_pattern),
-base_buffer_(std::move(base_buffer)),
-levels_(std::move(levels)),
-min_item_(min_item.release()),
-max_item_(max_item.release()),
-sorted_view_(nullptr)
-{
-  uint32_t item_count = base_buffer_.size();
-  for (Level& lvl : levels_) {
-    item_count += lvl.size();
-  }
-  if (item_count != compute_retained_items(k_, n_))
-    throw std::logic_error("Item count does not match value computed from k, n");
-}
-
 template<typename T, typename C, typename A>
 template<typename From, typename FC, typename FA>
 quantiles_sketch<T, C, A>::quantiles_sketch(const quantiles_sketch<From, FC, FA>& other,
     const C& comparator, const A& allocator):
-comparator_(comparator),
-allocator_(allocator),
-is_base_buffer_sorted_(false),
-k_(other.get_k()),
-n_(other.get_n()),
-bit_pattern_(compute_bit_pattern(other.get_k(), other.get_n())),
-base_buffer_(allocator),
-levels_(allocator),
-min_item_(nullptr),
-max_item_(nullptr),
-sorted_view_(nullptr)
+quantiles_sketch(other.get_k(), comparator, allocator, compute_items_capacity(other.get_k(), other.get_n()))
 {
   static_assert(std::is_constructible<T, From>::value,
                 "Type converting constructor requires new type to be constructible from existing type");
 
-  base_buffer_.reserve(2 * std::min(quantiles_constants::MIN_K, k_));
-
+  is_base_buffer_sorted_ = false;
   if (!other.is_empty()) {
     min_item_ = new (allocator_.allocate(1)) T(other.get_min_item());
     max_item_ = new (allocator_.allocate(1)) T(other.get_max_item());
 
-    // reserve space in levels
-    const uint8_t num_levels = compute_levels_needed(k_, n_);
-    levels_.reserve(num_levels);
-    for (int i = 0; i < num_levels; ++i) {
-      Level level(allocator);
-      level.reserve(k_);
-      levels_.push_back(std::move(level));
+    // the iterator goes through the base buffer and then through the levels in order
+    auto it = other.begin();
+    const uint32_t bb_count = compute_base_buffer_items(k_, other.get_n());
+    for (uint32_t i = 0; i < bb_count; ++i, ++it) {
+      new (&items_[i]) T((*it).first);
+      ++n_;
     }
-
-    // iterate through points, assigning to the correct level as needed
-    for (auto pair : other) {
-      const uint64_t wt = pair.second;
-      if (wt == 1) {
-        base_buffer_.push_back(T(pair.first));
-        // resize where needed as if adding points via update()
-        if (base_buffer_.size() + 1 > base_buffer_.capacity()) {
-          const size_t new_size = std::max(std::min(static_cast<size_t>(2 * k_), 2 * base_buffer_.size()), static_cast<size_t>(1));
-          base_buffer_.reserve(new_size);
-        }
-      }
-      else {
-        const uint8_t idx = count_trailing_zeros_in_u64(pair.second) - 1;
-        levels_[idx].push_back(T(pair.first));
-      }
-    }
-
-    // validate that ordering within each level is preserved
-    // base_buffer_ can be considered unsorted for this purpose
-    for (int i = 0; i < num_levels; ++i) {
-      if (!std::is_sorted(levels_[i].begin(), levels_[i].end(), comparator_)) {
+    uint64_t bits = compute_bit_pattern(k_, other.get_n());
+    for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+      if ((bits & 1) == 0) continue;
+      items_guard level(get_level(lvl), 0);
+      for (uint16_t i = 0; i < k_; ++i, ++it) level.emplace_back((*it).first);
+      level.release();
+      bit_pattern_ |= static_cast<uint64_t>(1) << lvl;
+
+      // validate that ordering within each level is preserved
+      // base buffer can be considered unsorted for this purpose
+      if (!std::is_sorted(get_level(lvl), get_level(lvl) + k_, comparator_)) {
         throw std::logic_error("Copy construction across types produces invalid sorting");
       }
     }
+    n_ = other.get_n();
   }
 }
 
 
 template<typename T, typename C, typename A>
 quantiles_sketch<T, C, A>::~quantiles_sketch() {
+  if (items_ != nullptr) {
+    destroy_items(items_, compute_base_buffer_items(k_, n_));
+    uint64_t bits = bit_pattern_;
+    for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+      if ((bits & 1) > 0) destroy_items(get_level(lvl), k_);
+    }
+    allocator_.deallocate(items_, items_capacity_);
+  }
+  if (merge_scratch_ != nullptr) allocator_.deallocate(merge_scratch_, 3 * k_);
   if (min_item_ != nullptr) {
     min_item_->~T();
     allocator_.deallocate(min_item_, 1);
@@ -236,16 +224,53 @@ void quantiles_sketch<T, C, A>::update(FwdT&& item) {
   }
 
   // if exceed capacity, grow until size 2k -- assumes eager processing
-  if (base_buffer_.size() + 1 > base_buffer_.capacity()) grow_base_buffer();
+  const uint32_t bb_count = compute_base_buffer_items(k_, n_);
+  if (bb_count + 1 > items_capacity_) grow_base_buffer();
 
-  base_buffer_.push_back(std::forward<FwdT>(item));
+  new (&items_[bb_count]) T(std::forward<FwdT>(item));
   ++n_;
 
-  if (base_buffer_.size() > 1) is_base_buffer_sorted_ = false;
-  if (base_buffer_.size() == 2 * k_) process_full_base_buffer();
+  if (bb_count > 0) is_base_buffer_sorted_ = false;
+  if (bb_count + 1 == 2 * k_) process_full_base_buffer();
   reset_sorted_view();
 }
 
+template<typename T, typename C, typename A>
+template<typename InputIt>
+void quantiles_sketch<T, C, A>::update(InputIt first, InputIt last) {
+  reset_sorted_view();
+  while (first != last) {
+    const uint32_t bb_count = compute_base_buffer_items(k_, n_);
+    if (bb_count == items_capacity_) grow_base_buffer();
+    // the block ends where the base buffer is full or has to grow
+    const uint32_t bb_end = std::min<uint32_t>(2 * k_, items_capacity_);
+    uint32_t index = bb_count;
+    const T* block_min = nullptr;
+    const T* block_max = nullptr;
+    // the block is counted in n_ once min and max are updated, until then it is destroyed in case of an exception
+    items_guard block(items_ + bb_count, 0);
+    for (; index < bb_end && first != last; ++first) {
+      if (!check_update_item(*first)) continue;
+      block.emplace_back(*first);
+      const T& item = items_[index++];
+      if (block_min == nullptr || comparator_(item, *block_min)) block_min = &item;
+      if (block_max == nullptr || comparator_(*block_max, item)) block_max = &item;
+    }
+    if (block_min == nullptr) continue;
+    if (is_empty()) {
+      min_item_ = new (allocator_.allocate(1)) T(*block_min);
+      max_item_ = new (allocator_.allocate(1)) T(*block_max);
+    } else {
+      if (comparator_(*block_min, *min_item_)) *min_item_ = *block_min;
+      if (comparator_(*max_item_, *block_max)) *max_item_ = *block_max;
+    }
+    block.release();
+    n_ += index - bb_count;
+    if (index > 1) is_base_buffer_sorted_ = false;
+    if (index == 2 * k_) process_full_base_buffer();
+  }
+}
+
 template<typename T, typename C, typename A>
 template<typename FwdSk>
 void quantiles_sketch<T, C, A>::merge(FwdSk&& other) {
@@ -253,8 +278,8 @@ void quantiles_sketch<T, C, A>::merge(FwdSk&& other) {
     return; // nothing to do
   } else if (!other.is_estimation_mode()) {
     // other is exact, stream in regardless of k
-    for (auto item : other.base_buffer_) {
-      update(conditional_forward<FwdSk>(item));
+    for (uint32_t i = 0; i < other.n_; ++i) {
+      update(conditional_forward<FwdSk>(other.items_[i]));
     }
     reset_sorted_view();
     return;
@@ -267,7 +292,7 @@ void quantiles_sketch<T, C, A>::merge(FwdSk&& other) {
     } else if (k_ > other.get_k()) {
       quantiles_sketch sk_copy(other);
       downsampling_merge(sk_copy, *this);
-      *this = sk_copy;
+      *this = std::move(sk_copy);
     } else { // k_ < other.get_k()
       downsampling_merge(*this, other);
     }
@@ -276,14 +301,14 @@ void quantiles_sketch<T, C, A>::merge(FwdSk&& other) {
     quantiles_sketch sk_copy(other);
     if (k_ <= other.get_k()) {
       if (!is_empty()) {
-        for (uint16_t i = 0; i < base_buffer_.size(); ++i) {
-          sk_copy.update(std::move(base_buffer_[i]));
+        for (uint32_t i = 0; i < n_; ++i) {
+          sk_copy.update(std::move(items_[i]));
         }
       }
     } else { // k_ > other.get_k()
       downsampling_merge(sk_copy, *this);
     }
-    *this = sk_copy;
+    *this = std::move(sk_copy);
   }
   reset_sorted_view();
 }
@@ -298,14 +323,14 @@ void quantiles_sketch<T, C, A>::serialize(std::ostream& os, const SerDe& serde)
   const uint8_t family = FAMILY;
   write(os, family);
 
-  // side-effect: sort base buffer since always compact
-  std::sort(const_cast<Level&>(base_buffer_).begin(), const_cast<Level&>(base_buffer_).end(), comparator_);
-  const_cast<quantiles_sketch*>(this)->is_base_buffer_sorted_ = true;
+  // always compact, so the base buffer is written in sorted order
+  Level scratch(allocator_);
+  const T* base_buffer = get_sorted_base_buffer(scratch);
 
   // empty, ordered, compact are valid flags
   const uint8_t flags_byte(
       (is_empty() ? 1 << flags::IS_EMPTY : 0)
-    | (1 << flags::IS_SORTED) // always sorted as side effect noted above
+    | (1 << flags::IS_SORTED) // always sorted as noted above
     | (1 << flags::IS_COMPACT) // always compact -- could be optional for numeric types?
   );
   write(os, flags_byte);
@@ -321,12 +346,13 @@ void quantiles_sketch<T, C, A>::serialize(std::ostream& os, const SerDe& serde)
     serde.serialize(os, max_item_, 1);
 
     // base buffer items
-    serde.serialize(os, base_buffer_.data(), static_cast<unsigned>(base_buffer_.size()));
+    serde.serialize(os, base_buffer, compute_base_buffer_items(k_, n_));
 
     // levels, only when data is present
-    for (Level lvl : levels_) {
-      if (lvl.size() > 0)
-        serde.serialize(os, lvl.data(), static_cast<unsigned>(lvl.size()));
+    uint64_t bits = bit_pattern_;
+    for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+      if ((bits & 1) > 0)
+        serde.serialize(os, get_level(lvl), k_);
     }
   }
 }
@@ -346,14 +372,14 @@ auto quantiles_sketch<T, C, A>::serialize(unsigned header_size_bytes, const SerD
   const uint8_t family = FAMILY;
   ptr += copy_to_mem(family, ptr);
 
-  // side-effect: sort base buffer since always compact
-  std::sort(const_cast<Level&>(base_buffer_).begin(), const_cast<Level&>(base_buffer_).end(), comparator_);
-  const_cast<quantiles_sketch*>(this)->is_base_buffer_sorted_ = true;
+  // always compact, so the base buffer is written in sorted order
+  Level scratch(allocator_);
+  const T* base_buffer = get_sorted_base_buffer(scratch);
 
   // empty, ordered, compact are valid flags
   const uint8_t flags_byte(
       (is_empty() ? 1 << flags::IS_EMPTY : 0)
-    | (1 << flags::IS_SORTED) // always sorted as side effect noted above
+    | (1 << flags::IS_SORTED) // always sorted as noted above
     | (1 << flags::IS_COMPACT) // always compact
   );
   ptr += copy_to_mem(flags_byte, ptr);
@@ -369,13 +395,15 @@ auto quantiles_sketch<T, C, A>::serialize(unsigned header_size_bytes, const SerD
     ptr += serde.serialize(ptr, end_ptr - ptr, max_item_, 1);
  
     // base buffer items
-    if (base_buffer_.size() > 0)
-      ptr += serde.serialize(ptr, end_ptr - ptr, base_buffer_.data(), static_cast<unsigned>(base_buffer_.size()));
+    const uint32_t bb_count = compute_base_buffer_items(k_, n_);
+    if (bb_count > 0)
+      ptr += serde.serialize(ptr, end_ptr - ptr, base_buffer, bb_count);
     
     // levels, only when data is present
-    for (Level lvl : levels_) {
-      if (lvl.size() > 0)
-        ptr += serde.serialize(ptr, end_ptr - ptr, lvl.data(), static_cast<unsigned>(lvl.size()));
+    uint64_t bits = bit_pattern_;
+    for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+      if ((bits & 1) > 0)
+        ptr += serde.serialize(ptr, end_ptr - ptr, get_level(lvl), k_);
     }
   }
 
@@ -436,54 +464,47 @@ auto quantiles_sketch<T, C, A>::deserialize(std::istream &is, const SerDe& serde
   // to avoid complications around serialization of empty values for generic type T. We also need
   // to be able to ingest either serialized format from Java.
 
+  // the items are read in place, the sketch keeps track of the ones read so far in case of an exception
+  // (a serde call that throws destroys the items it has built)
+  quantiles_sketch sketch(k, comparator, allocator, 2 * k + levels_needed * k);
+
   // load base buffer
   const uint32_t bb_items = compute_base_buffer_items(k, items_seen);
   uint32_t items_to_read = (levels_needed == 0 || is_compact) ? bb_items : 2 * k;
-  Level base_buffer = deserialize_array(is, bb_items, 2 * k, serde, allocator);
+  serde.deserialize(is, sketch.items_, bb_items);
+  sketch.n_ = bb_items;
+  if (!is.good()) throw std::runtime_error("error reading from std::istream");
   if (items_to_read > bb_items) { // either equal or greater, never read fewer items
     // read remaining items, but don't store them
-    deserialize_array(is, items_to_read - bb_items, items_to_read - bb_items, serde, allocator);
-  }
-
-  // populate vector of Levels directly
-  VectorLevels levels(allocator);
-  levels.reserve(levels_needed);
-  if (levels_needed > 0) {
-    uint64_t working_pattern = bit_pattern;
-    for (size_t i = 0; i < levels_needed; ++i, working_pattern >>= 1) {
-      if ((working_pattern & 0x01) == 1) {
-        Level level = deserialize_array(is, k, k, serde, allocator);
-        levels.push_back(std::move(level));
-      } else {
-        Level level(allocator);
-        level.reserve(k);
-        levels.push_back(std::move(level));
-      }
+    skip_items(is, items_to_read - bb_items, serde, allocator);
+  }
+
+  // load levels directly into place
+  uint64_t working_pattern = bit_pattern;
+  for (uint8_t i = 0; i < levels_needed; ++i, working_pattern >>= 1) {
+    if ((working_pattern & 0x01) == 1) {
+      serde.deserialize(is, sketch.get_level(i), k);
+      sketch.bit_pattern_ |= static_cast<uint64_t>(1) << i;
+      if (!is.good()) throw std::runtime_error("error reading from std::istream");
     }
   }
 
-  return quantiles_sketch(k, items_seen, bit_pattern,
-    std::move(base_buffer), std::move(levels), std::move(min_item), std::move(max_item), is_sorted,
-    comparator, allocator);
+  sketch.n_ = items_seen;
+  sketch.is_base_buffer_sorted_ = is_sorted;
+  sketch.min_item_ = min_item.release();
+  sketch.max_item_ = max_item.release();
+  return sketch;
 }
 
 template<typename T, typename C, typename A>
 template<typename SerDe>
-auto quantiles_sketch<T, C, A>::deserialize_array(std::istream& is, uint32_t num_items, uint32_t capacity, const SerDe& serde, const A& allocator) -> Level {
+void quantiles_sketch<T, C, A>::skip_items(std::istream& is, uint32_t num_items, const SerDe& serde, const A& allocator) {
   A alloc(allocator);
   std::unique_ptr<T, items_deleter> items(alloc.allocate(num_items), items_deleter(allocator, false, num_items));
   serde.deserialize(is, items.get(), num_items);
   // serde did not throw, enable destructors
   items.get_deleter().set_destroy(true);
   if (!is.good()) throw std::runtime_error("error reading from std::istream");
-
-  // succesfully read, now put into a Level
-  Level level(allocator);
-  level.reserve(capacity);
-  level.insert(level.begin(),
-               std::make_move_iterator(items.get()),
-               std::make_move_iterator(items.get() + num_items));
-  return level;
 }
 
 template<typename T, typename C, typename A>
@@ -552,61 +573,45 @@ auto quantiles_sketch<T, C, A>::deserialize(const void* bytes, size_t size, cons
   // to avoid complications around serialization of empty values for generic type T. We also need
   // to be able to ingest either serialized format from Java.
 
+  // the items are read in place, the sketch keeps track of the ones read so far in case of an exception
+  // (a serde call that throws destroys the items it has built)
+  quantiles_sketch sketch(k, comparator, allocator, 2 * k + levels_needed * k);
+
   // load base buffer
   const uint32_t bb_items = compute_base_buffer_items(k, items_seen);
   uint32_t items_to_read = (levels_needed == 0 || is_compact) ? bb_items : 2 * k;
-  auto base_buffer_pair = deserialize_array(ptr, end_ptr - ptr, bb_items, 2 * k, serde, allocator);
-  ptr += base_buffer_pair.second;
+  ptr += serde.deserialize(ptr, end_ptr - ptr, sketch.items_, bb_items);
+  sketch.n_ = bb_items;
   if (items_to_read > bb_items) { // either equal or greater, never read fewer items
     // read remaining items, only use to advance the pointer
-    auto extras = deserialize_array(ptr, end_ptr - ptr, items_to_read - bb_items, items_to_read - bb_items, serde, allocator);
-    ptr += extras.second;
-  }
-
-  // populate vector of Levels directly
-  VectorLevels levels(allocator);
-  levels.reserve(levels_needed);
-  if (levels_needed > 0) {
-    uint64_t working_pattern = bit_pattern;
-    for (size_t i = 0; i < levels_needed; ++i, working_pattern >>= 1) {
-     
-      if ((working_pattern & 0x01) == 1) {
-        auto pair = deserialize_array(ptr, end_ptr - ptr, k, k, serde, allocator);
-        ptr += pair.second;
-        levels.push_back(std::move(pair.first));
-      } else {
-        Level level(allocator);
-        level.reserve(k);
-        levels.push_back(std::move(level));
-      }
+    ptr += skip_items(ptr, end_ptr - ptr, items_to_read - bb_items, serde, allocator);
+  }
+
+  // load levels directly into place
+  uint64_t working_pattern = bit_pattern;
+  for (uint8_t i = 0; i < levels_needed; ++i, working_pattern >>= 1) {
+    if ((working_pattern & 0x01) == 1) {
+      ptr += serde.deserialize(ptr, end_ptr - ptr, sketch.get_level(i), k);
+      sketch.bit_pattern_ |= static_cast<uint64_t>(1) << i;
     }
   }
 
-  return quantiles_sketch(k, items_seen, bit_pattern,
-    std::move(base_buffer_pair.first), std::move(levels), std::move(min_item), std::move(max_item), is_sorted,
-    comparator, allocator);
+  sketch.n_ = items_seen;
+  sketch.is_base_buffer_sorted_ = is_sorted;
+  sketch.min_item_ = min_item.release();
+  sketch.max_item_ = max_item.release();
+  return sketch;
 }
 
 template<typename T, typename C, typename A>
 template<typename SerDe>
-auto quantiles_sketch<T, C, A>::deserialize_array(const void* bytes, size_t size, uint32_t num_items, uint32_t capacity, const SerDe& serde, const A& allocator)
-  -> std::pair<Level, size_t> {
-  const char* ptr = static_cast<const char*>(bytes);
-  const char* end_ptr = static_cast<const char*>(bytes) + size;
+size_t quantiles_sketch<T, C, A>::skip_items(const void* bytes, size_t size, uint32_t num_items, const SerDe& serde, const A& allocator) {
   A alloc(allocator);
   std::unique_ptr<T, items_deleter> items(alloc.allocate(num_items), items_deleter(allocator, false, num_items));
-  ptr += serde.deserialize(ptr, end_ptr - ptr, items.get(), num_items);
+  const size_t bytes_read = serde.deserialize(bytes, size, items.get(), num_items);
   // serde did not throw, enable destructors
   items.get_deleter().set_destroy(true);
-  
-  // succesfully read, now put into a Level
-  Level level(allocator);
-  level.reserve(capacity);
-  level.insert(level.begin(),
-               std::make_move_iterator(items.get()),
-               std::make_move_iterator(items.get() + num_items));
-  
-  return std::pair<Level, size_t>(std::move(level), ptr - static_cast<const char*>(bytes));
+  return bytes_read;
 }
 
 template<typename T, typename C, typename A>
@@ -621,7 +626,7 @@ string<A> quantiles_sketch<T, C, A>::to_string(bool print_levels, bool print_ite
   os << "   Epsilon PMF    : " << get_normalized_rank_error(true) * 100 << "%" << std::endl;
   os << "   Empty          : " << (is_empty() ? "true" : "false") << std::endl;
   os << "   Estimation mode: " << (is_estimation_mode() ? "true" : "false") << std::endl;
-  os << "   Levels (w/o BB): " << levels_.size() << std::endl;
+  os << "   Levels (w/o BB): " << static_cast<unsigned int>(num_levels_) << std::endl;
   os << "   Used Levels    : " << count_valid_levels(bit_pattern_) << std::endl;
   os << "   Retained items : " << get_num_retained() << std::endl;
   if (!is_empty()) {
@@ -633,24 +638,25 @@ string<A> quantiles_sketch<T, C, A>::to_string(bool print_levels, bool print_ite
   if (print_levels) {
     os << "### Quantiles Sketch levels:" << std::endl;
     os << "   index: items in use" << std::endl;
-    os << "   BB: " << base_buffer_.size() << std::endl;
-    for (uint8_t i = 0; i < levels_.size(); i++) {
-      os << "   " << static_cast<unsigned int>(i) << ": " << levels_[i].size() << std::endl;
+    os << "   BB: " << compute_base_buffer_items(k_, n_) << std::endl;
+    for (uint8_t i = 0; i < num_levels_; i++) {
+      os << "   " << static_cast<unsigned int>(i) << ": " << ((bit_pattern_ >> i) & 1) * k_ << std::endl;
     }
     os << "### End sketch levels" << std::endl;
   }
 
   if (print_items) {
     os << "### Quantiles Sketch data:" << std::endl;
-    uint8_t level = 0;
     os << " BB:" << std::endl;
-    for (const T& item : base_buffer_) {
-      os << "    " << std::to_string(item) << std::endl;
+    const uint32_t bb_count = compute_base_buffer_items(k_, n_);
+    for (uint32_t i = 0; i < bb_count; ++i) {
+      os << "    " << std::to_string(items_[i]) << std::endl;
     }
-    for (uint8_t i = 0; i < levels_.size(); ++i) {
-      os << " level " << static_cast<unsigned int>(level) << ":" << std::endl;
-      for (const T& item : levels_[i]) {
-        os << "   " << std::to_string(item) << std::endl;
+    for (uint8_t i = 0; i < num_levels_; ++i) {
+      os << " level " << static_cast<unsigned int>(i) << ":" << std::endl;
+      if (((bit_pattern_ >> i) & 1) == 0) continue;
+      for (uint16_t j = 0; j < k_; ++j) {
+        os << "   " << std::to_string(get_level(i)[j]) << std::endl;
       }
     }
     os << "### End sketch data" << std::endl;
@@ -739,53 +745,53 @@ double quantiles_sketch<T, C, A>::get_normalized_rank_error(uint16_t k, bool is_
 
 template<typename T, typename C, typename A>
 quantiles_sorted_view<T, C, A> quantiles_sketch<T, C, A>::get_sorted_view() const {
-  // allow side-effect of sorting the base buffer
-  if (!is_base_buffer_sorted_) {
-    std::sort(const_cast<Level&>(base_buffer_).begin(), const_cast<Level&>(base_buffer_).end(), comparator_);
-    const_cast<quantiles_sketch*>(this)->is_base_buffer_sorted_ = true;
-  }
   quantiles_sorted_view<T, C, A> view(get_num_retained(), comparator_, allocator_);
 
   uint64_t weight = 1;
-  view.add(base_buffer_.begin(), base_buffer_.end(), weight);
-  for (const auto& level: levels_) {
+  // the base buffer is left as is, so that queries do not modify the sketch
+  const T* base_buffer = items_;
+  const T* base_buffer_end = items_ + compute_base_buffer_items(k_, n_);
+  if (is_base_buffer_sorted_) {
+    view.add(base_buffer, base_buffer_end, weight);
+  } else {
+    view.add_unsorted(base_buffer, base_buffer_end, weight);
+  }
+  uint64_t bits = bit_pattern_;
+  for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
     weight <<= 1;
-    if (level.empty()) { continue; }
-    view.add(level.begin(), level.end(), weight);
+    if ((bits & 1) == 0) { continue; }
+    const T* level = get_level(lvl);
+    view.add(level, level + k_, weight);
   }
 
   view.convert_to_cummulative();
   return view;
 }
 
+template<typename T, typename C, typename A>
+quantiles_snapshot<T, C, A> quantiles_sketch<T, C, A>::freeze() const {
+  return quantiles_snapshot<T, C, A>(get_sorted_view(), n_, min_item_, max_item_, allocator_);
+}
+
 template<typename T, typename C, typename A>
 auto quantiles_sketch<T, C, A>::get_quantile(double rank, bool inclusive) const -> quantile_return_type {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
   if ((rank < 0.0) || (rank > 1.0)) {
     throw std::invalid_argument("Normalized rank cannot be less than 0 or greater than 1");
   }
-  // possible side-effect: sorting base buffer
-  setup_sorted_view();
-  return sorted_view_->get_quantile(rank, inclusive);
+  return setup_sorted_view().get_quantile(rank, inclusive);
 }
 
 template<typename T, typename C, typename A>
 std::vector<T, A> quantiles_sketch<T, C, A>::get_quantiles(const double* ranks, uint32_t size, bool inclusive) const {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  std::vector<T, A> quantiles(allocator_);
-  quantiles.reserve(size);
-
-  // possible side-effect: sorting base buffer
-  setup_sorted_view();
-
   for (uint32_t i = 0; i < size; ++i) {
     const double rank = ranks[i];
     if ((rank < 0.0) || (rank > 1.0)) {
       throw std::invalid_argument("Normalized rank cannot be less than 0 or greater than 1");
     }
-    quantiles.push_back(sorted_view_->get_quantile(rank, inclusive));
   }
-  return quantiles;
+  return setup_sorted_view().get_quantiles(ranks, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
@@ -808,22 +814,25 @@ std::vector<T, A> quantiles_sketch<T, C, A>::get_quantiles(uint32_t num, bool in
 template<typename T, typename C, typename A>
 double quantiles_sketch<T, C, A>::get_rank(const T& item, bool inclusive) const {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_rank(item, inclusive);
+  return setup_sorted_view().get_rank(item, inclusive);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_sketch<T, C, A>::get_ranks(const T* items, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return setup_sorted_view().get_ranks(items, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 auto quantiles_sketch<T, C, A>::get_PMF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_PMF(split_points, size, inclusive);
+  return setup_sorted_view().get_PMF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 auto quantiles_sketch<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_CDF(split_points, size, inclusive);
+  return setup_sorted_view().get_CDF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
@@ -856,6 +865,14 @@ uint8_t quantiles_sketch<T, C, A>::compute_levels_needed(uint16_t k, uint64_t n)
   return static_cast<uint8_t>(64U) - count_leading_zeros_in_u64(n / (2 * k));
 }
 
+template<typename T, typename C, typename A>
+uint32_t quantiles_sketch<T, C, A>::compute_items_capacity(uint16_t k, uint64_t n) {
+  const uint8_t num_levels = compute_levels_needed(k, n);
+  if (num_levels > 0) return 2 * k + num_levels * k;
+  const uint32_t bb_count = compute_base_buffer_items(k, n);
+  return std::max<uint32_t>(2 * std::min(quantiles_constants::MIN_K, k), std::min<uint32_t>(2 * k, 2 * bb_count));
+}
+
 template<typename T, typename C, typename A>
 void quantiles_sketch<T, C, A>::check_k(uint16_t k) {
   if (k < quantiles_constants::MIN_K || k > quantiles_constants::MAX_K || (k & (k - 1)) != 0) {
@@ -918,31 +935,87 @@ void quantiles_sketch<T, C, A>::check_header_validity(uint8_t preamble_longs, ui
 
 template <typename T, typename C, typename A>
 typename quantiles_sketch<T, C, A>::const_iterator quantiles_sketch<T, C, A>::begin() const {
-  return quantiles_sketch<T, C, A>::const_iterator(base_buffer_, levels_, k_, n_, false);
+  return quantiles_sketch<T, C, A>::const_iterator(items_, k_, n_, false);
 }
 
 template <typename T, typename C, typename A>
 typename quantiles_sketch<T, C, A>::const_iterator quantiles_sketch<T, C, A>::end() const {
-  return quantiles_sketch<T, C, A>::const_iterator(base_buffer_, levels_, k_, n_, true);
+  return quantiles_sketch<T, C, A>::const_iterator(items_, k_, n_, true);
+}
+
+template<typename T, typename C, typename A>
+T* quantiles_sketch<T, C, A>::get_level(uint8_t level) {
+  return items_ + 2 * k_ + level * k_;
+}
+
+template<typename T, typename C, typename A>
+const T* quantiles_sketch<T, C, A>::get_level(uint8_t level) const {
+  return items_ + 2 * k_ + level * k_;
+}
+
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::reallocate_items(uint32_t capacity, uint32_t num_base_items) {
+  // the items are moved into a sketch that holds the new buffer and takes care of the levels moved so far,
+  // and the old buffer is left as it is until all of them are moved, in case a move throws
+  quantiles_sketch grown(k_, comparator_, allocator_, capacity);
+  items_guard base_buffer(grown.items_, 0);
+  for (uint32_t i = 0; i < num_base_items; ++i) base_buffer.emplace_back(std::move(items_[i]));
+  // levels keep their offsets, since those depend on k only
+  uint64_t bits = bit_pattern_;
+  for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+    if ((bits & 1) == 0) continue;
+    items_guard level(grown.get_level(lvl), 0);
+    T* old_level = get_level(lvl);
+    for (uint16_t i = 0; i < k_; ++i) level.emplace_back(std::move(old_level[i]));
+    level.release();
+    grown.bit_pattern_ |= static_cast<uint64_t>(1) << lvl;
+  }
+  base_buffer.release();
+
+  destroy_items(items_, num_base_items);
+  bits = bit_pattern_;
+  for (uint8_t lvl = 0; bits != 0; ++lvl, bits >>= 1) {
+    if ((bits & 1) > 0) destroy_items(get_level(lvl), k_);
+  }
+  // the old buffer goes away with the other sketch, which holds no items now
+  grown.bit_pattern_ = 0;
+  std::swap(items_, grown.items_);
+  std::swap(items_capacity_, grown.items_capacity_);
+  std::swap(num_levels_, grown.num_levels_);
 }
 
 template<typename T, typename C, typename A>
 void quantiles_sketch<T, C, A>::grow_base_buffer() {
-  const size_t new_size = std::max(std::min(static_cast<size_t>(2 * k_), 2 * base_buffer_.size()), static_cast<size_t>(1));
-  base_buffer_.reserve(new_size);
+  const uint32_t bb_count = compute_base_buffer_items(k_, n_);
+  const uint32_t new_size = std::max(std::min<uint32_t>(2 * k_, 2 * bb_count), 1u);
+  reallocate_items(new_size, bb_count);
+}
+
+template<typename T, typename C, typename A>
+auto quantiles_sketch<T, C, A>::get_sorted_base_buffer(Level& scratch) const -> const T* {
+  if (is_base_buffer_sorted_) return items_;
+  scratch.assign(items_, items_ + compute_base_buffer_items(k_, n_));
+  sort_utils::sort(scratch.data(), scratch.data() + scratch.size(), comparator_, allocator_);
+  return scratch.data();
 }
 
 template<typename T, typename C, typename A>
 void quantiles_sketch<T, C, A>::process_full_base_buffer() {
+  // n_ was already incremented by update() before this, so it counts the full base buffer as empty,
+  // and the base buffer is destroyed here if growing the levels or sorting throws
+
   // make sure there will be enough levels for the propagation
-  grow_levels_if_needed(); // note: n_ was already incremented by update() before this
-
-  std::sort(base_buffer_.begin(), base_buffer_.end(), comparator_);
-  in_place_propagate_carry(0,
-                           levels_[0], // unused here, but 0 is guaranteed to exist
-                           base_buffer_,
-                           true, *this);
-  base_buffer_.clear();
+  {
+    items_guard base_buffer(items_, 2 * k_);
+    grow_levels_if_needed(); // leaves the base buffer in place if it throws
+    base_buffer.release();
+  }
+  {
+    items_guard base_buffer(items_, 2 * k_);
+    sort_utils::sort(items_, items_ + 2 * k_, comparator_, sort_scratch_);
+    base_buffer.release();
+  }
+  in_place_propagate_carry<quantiles_sketch&, T>(0, nullptr, items_, true, *this);
   is_base_buffer_sorted_ = true;
   if (n_ / (2 * k_) != bit_pattern_) {
     throw std::logic_error("Internal error: n / 2k (" + std::to_string(n_ / 2 * k_)
@@ -950,6 +1023,12 @@ void quantiles_sketch<T, C, A>::process_full_base_buffer() {
   }
 }
 
+template<typename T, typename C, typename A>
+T* quantiles_sketch<T, C, A>::get_merge_scratch() {
+  if (merge_scratch_ == nullptr) merge_scratch_ = allocator_.allocate(3 * k_);
+  return merge_scratch_;
+}
+
 template<typename T, typename C, typename A>
 bool quantiles_sketch<T, C, A>::grow_levels_if_needed() {
   const uint8_t levels_needed = compute_levels_needed(k_, n_);
@@ -957,123 +1036,129 @@ bool quantiles_sketch<T, C, A>::grow_levels_if_needed() {
     return false; // don't need levels and might have small base buffer. Possible during merges.
 
   // from here on, assume full size base buffer (2k) and at least one additional level
-  if (levels_needed <= levels_.size())
+  if (levels_needed <= num_levels_)
     return false;
 
-  Level empty_level(allocator_);
-  empty_level.reserve(k_);
-  levels_.push_back(std::move(empty_level));
+  reallocate_items(2 * k_ + levels_needed * k_, 2 * k_);
   return true;
 }
 
 template<typename T, typename C, typename A>
-template<typename FwdV>
+template<typename FwdSk, typename SrcT>
 void quantiles_sketch<T, C, A>::in_place_propagate_carry(uint8_t starting_level,
-                                                         FwdV&& buf_size_k, Level& buf_size_2k, 
+                                                         SrcT* buf_size_k, T* buf_size_2k,
                                                          bool apply_as_update,
                                                          quantiles_sketch& sketch) {
   const uint64_t bit_pattern = sketch.bit_pattern_;
-  const int k = sketch.k_;
+  const uint16_t k = sketch.k_;
 
   uint8_t ending_level = lowest_zero_bit_starting_at(bit_pattern, starting_level);
+  T* ending = sketch.get_level(ending_level);
+  const uint64_t ending_bit = static_cast<uint64_t>(1) << ending_level;
 
   if (apply_as_update) {
     // update version of computation
     // its is okay for buf_size_k to be null in this case
-    zip_buffer(buf_size_2k, sketch.levels_[ending_level]);
+    // the base buffer is empty from here on and serves as the scratch space
+    items_guard base_buffer(buf_size_2k, 2 * k);
+    zip_buffer(buf_size_2k, ending, k);
   } else {
     // merge_into version of computation
-    for (uint16_t i = 0; i < k; ++i) {
-      sketch.levels_[ending_level].push_back(conditional_forward<FwdV>(buf_size_k[i]));
-    }
+    items_guard level(ending, 0);
+    for (uint16_t i = 0; i < k; ++i) level.emplace_back(conditional_forward<FwdSk>(buf_size_k[i]));
+    level.release();
   }
+  sketch.bit_pattern_ |= ending_bit;
 
+  // binary-arithmetic ripple carry, one level at a time
   for (uint64_t lvl = starting_level; lvl < ending_level; lvl++) {
-    if ((bit_pattern & (static_cast<uint64_t>(1) << lvl)) == 0) {
+    const uint64_t level_bit = static_cast<uint64_t>(1) << lvl;
+    if ((bit_pattern & level_bit) == 0) {
       throw std::logic_error("unexpected empty level in bit_pattern");
     }
-    merge_two_size_k_buffers(
-        sketch.levels_[lvl],
-        sketch.levels_[ending_level],
-        buf_size_2k, sketch.get_comparator());
-    sketch.levels_[lvl].clear();
-    sketch.levels_[ending_level].clear();
-    zip_buffer(buf_size_2k, sketch.levels_[ending_level]);
+    T* level = sketch.get_level(static_cast<uint8_t>(lvl));
+    merge_two_size_k_buffers(level, ending, buf_size_2k, k, sketch.comparator_);
+    items_guard merged(buf_size_2k, 2 * k);
+    destroy_items(level, k);
+    destroy_items(ending, k);
+    sketch.bit_pattern_ &= ~(level_bit | ending_bit);
+    zip_buffer(buf_size_2k, ending, k);
+    sketch.bit_pattern_ |= ending_bit;
   } // end of loop over lower levels
-
-  // update bit pattern with binary-arithmetic ripple carry
-  sketch.bit_pattern_ = bit_pattern + (static_cast<uint64_t>(1) << starting_level);
 }
 
 template<typename T, typename C, typename A>
-void quantiles_sketch<T, C, A>::zip_buffer(Level& buf_in, Level& buf_out) {
+void quantiles_sketch<T, C, A>::zip_buffer(T* buf_in, T* buf_out, uint16_t k) {
 #ifdef QUANTILES_VALIDATION
   static uint32_t next_offset = 0;
   uint32_t rand_offset = next_offset;
   next_offset = 1 - next_offset;
 #else
-  uint32_t rand_offset = random_bit();
+  uint32_t rand_offset = random_utils::random_bit();
 #endif
-  if ((buf_in.size() != 2 * buf_out.capacity())
-    || (buf_out.size() > 0)) {
-      throw std::logic_error("zip_buffer requires buf_in.size() == "
-        "2*buf_out.capacity() and empty buf_out");
-  }
+  zip_buffer(buf_in, buf_out, k, rand_offset, compaction_kernels::is_supported<T>());
+}
 
-  size_t k = buf_out.capacity();
-  for (uint32_t i = rand_offset, o = 0; o < k; i += 2, ++o) {
-    buf_out.push_back(std::move(buf_in[i]));
-  }
-  buf_in.clear();
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::zip_buffer(T* buf_in, T* buf_out, uint16_t k, uint32_t offset, std::true_type) {
+  compaction_kernels::decimate(buf_in + offset, buf_out, k);
+}
+
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::zip_buffer(T* buf_in, T* buf_out, uint16_t k, uint32_t offset, std::false_type) {
+  items_guard zipped(buf_out, 0);
+  for (uint32_t i = offset; i < offset + 2u * k; i += 2) zipped.emplace_back(std::move(buf_in[i]));
+  zipped.release();
 }
 
 template<typename T, typename C, typename A>
-template<typename FwdV>
-void quantiles_sketch<T, C, A>::zip_buffer_with_stride(FwdV&& buf_in, Level& buf_out, uint16_t stride) {
+template<typename FwdSk, typename SrcT>
+void quantiles_sketch<T, C, A>::zip_buffer_with_stride(SrcT* buf_in, T* buf_out, uint16_t k, uint16_t stride) {
   // Random offset in range [0, stride)
   std::uniform_int_distribution<uint16_t> dist(0, stride - 1);
-  const uint16_t rand_offset = dist(random_utils::rand);
+  const uint16_t rand_offset = dist(random_utils::engine());
   
-  if ((buf_in.size() != stride * buf_out.capacity())
-    || (buf_out.size() > 0)) {
-      throw std::logic_error("zip_buffer_with_stride requires buf_in.size() == "
-        "stride*buf_out.capacity() and empty buf_out");
-  }
-  
-  const size_t k = buf_out.capacity();
-  for (uint16_t i = rand_offset, o = 0; o < k; i += stride, ++o) {
-    buf_out.push_back(conditional_forward<FwdV>(buf_in[i]));
+  items_guard zipped(buf_out, 0);
+  for (uint32_t i = rand_offset; i < rand_offset + static_cast<uint32_t>(stride) * k; i += stride) {
+    zipped.emplace_back(conditional_forward<FwdSk>(buf_in[i]));
   }
+  zipped.release();
   // do not clear input buffer
 }
 
 template<typename T, typename C, typename A>
-void quantiles_sketch<T, C, A>::merge_two_size_k_buffers(Level& src_1, Level& src_2,
-    Level& dst, const C& comparator) {
-  if (src_1.size() != src_2.size()
-    || src_1.size() * 2 != dst.capacity()
-    || dst.size() != 0) {
-      throw std::logic_error("Input invariants violated in merge_two_size_k_buffers()");
-  }
+void quantiles_sketch<T, C, A>::merge_two_size_k_buffers(T* src_1, T* src_2,
+    T* dst, uint16_t k, const C& comparator) {
+  merge_two_size_k_buffers(src_1, src_2, dst, k, comparator, compaction_kernels::has_merge_network<T, C>());
+}
 
-  auto end1 = src_1.end(), end2 = src_2.end();
-  auto it1 = src_1.begin(), it2 = src_2.begin();
-  
-  // TODO: probably actually doing copies given Level&?
-  while (it1 != end1 && it2 != end2) {
-    if (comparator(*it1, *it2)) {
-      dst.push_back(std::move(*it1++));
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::merge_two_size_k_buffers(T* src_1, T* src_2,
+    T* dst, uint16_t k, const C&, std::true_type) {
+  compaction_kernels::merge<T, C>(src_1, k, src_2, k, dst);
+}
+
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::merge_two_size_k_buffers(T* src_1, T* src_2,
+    T* dst, uint16_t k, const C& comparator, std::false_type) {
+  T* end1 = src_1 + k;
+  T* end2 = src_2 + k;
+  items_guard merged(dst, 0);
+  while (src_1 != end1 && src_2 != end2) {
+    if (comparator(*src_1, *src_2)) {
+      merged.emplace_back(std::move(*src_1++));
     } else {
-      dst.push_back(std::move(*it2++));
+      merged.emplace_back(std::move(*src_2++));
     }
   }
+  while (src_1 != end1) merged.emplace_back(std::move(*src_1++));
+  while (src_2 != end2) merged.emplace_back(std::move(*src_2++));
+  merged.release();
+}
 
-  if (it1 != end1) {
-    dst.insert(dst.end(), it1, end1);
-  } else {
-    if (it2 == end2) { throw std::logic_error("it2 unexpectedly already at end of range"); }
-    dst.insert(dst.end(), it2, end2);
-  }
+template<typename T, typename C, typename A>
+void quantiles_sketch<T, C, A>::destroy_items(T* items, uint32_t num) {
+  for (uint32_t i = 0; i < num; ++i) items[i].~T();
 }
 
 template<typename T, typename C, typename A>
@@ -1089,33 +1174,24 @@ void quantiles_sketch<T, C, A>::standard_merge(quantiles_sketch& tgt, FwdSk&& sr
   uint64_t new_n = src.get_n() + tgt.get_n();
 
   // move items from src's base buffer
-  for (uint16_t i = 0; i < src.base_buffer_.size(); ++i) {
-    tgt.update(conditional_forward<FwdSk>(src.base_buffer_[i]));
+  const uint32_t src_bb_count = compute_base_buffer_items(src.k_, src.n_);
+  for (uint32_t i = 0; i < src_bb_count; ++i) {
+    tgt.update(conditional_forward<FwdSk>(src.items_[i]));
   }
 
   // check (after moving raw items) if we need to extend levels array
   uint8_t levels_needed = compute_levels_needed(tgt.get_k(), new_n);
-  if (levels_needed > tgt.levels_.size()) {
-    tgt.levels_.reserve(levels_needed);
-    while (tgt.levels_.size() < levels_needed) {
-      Level empty_level(tgt.allocator_);
-      empty_level.reserve(tgt.get_k());
-      tgt.levels_.push_back(std::move(empty_level));
-    }
+  if (levels_needed > tgt.num_levels_) {
+    tgt.reallocate_items(2 * tgt.k_ + levels_needed * tgt.k_, compute_base_buffer_items(tgt.k_, tgt.n_));
   }
 
-  Level scratch_buf(tgt.allocator_);
-  scratch_buf.reserve(2 * tgt.get_k());
+  T* scratch_buf = tgt.get_merge_scratch();
 
   uint64_t src_pattern = src.bit_pattern_;
   for (uint8_t src_lvl = 0; src_pattern != 0; ++src_lvl, src_pattern >>= 1) {
     if ((src_pattern & 1) > 0) {
-      scratch_buf.clear();
-
       // propagate-carry
-      in_place_propagate_carry(src_lvl,
-                               src.levels_[src_lvl], scratch_buf,
-                               false, tgt);
+      in_place_propagate_carry<FwdSk>(src_lvl, src.get_level(src_lvl), scratch_buf, false, tgt);
       // update n_ at the end
     }
   }
@@ -1158,40 +1234,31 @@ void quantiles_sketch<T, C, A>::downsampling_merge(quantiles_sketch& tgt, FwdSk&
   const uint64_t new_n = src.get_n() + tgt.get_n();
 
   // move items from src's base buffer
-  for (uint16_t i = 0; i < src.base_buffer_.size(); ++i) {
-    tgt.update(conditional_forward<FwdSk>(src.base_buffer_[i]));
+  const uint32_t src_bb_count = compute_base_buffer_items(src.k_, src.n_);
+  for (uint32_t i = 0; i < src_bb_count; ++i) {
+    tgt.update(conditional_forward<FwdSk>(src.items_[i]));
   }
 
   // check (after moving raw items) if we need to extend levels array
   const uint8_t levels_needed = compute_levels_needed(tgt.get_k(), new_n);
-  if (levels_needed > tgt.levels_.size()) {
-    tgt.levels_.reserve(levels_needed);
-    while (tgt.levels_.size() < levels_needed) {
-      Level empty_level(tgt.allocator_);
-      empty_level.reserve(tgt.get_k());
-      tgt.levels_.push_back(std::move(empty_level));
-    }
+  if (levels_needed > tgt.num_levels_) {
+    tgt.reallocate_items(2 * tgt.k_ + levels_needed * tgt.k_, compute_base_buffer_items(tgt.k_, tgt.n_));
   }
 
-  Level down_buf(tgt.allocator_);
-  down_buf.reserve(tgt.get_k());
-
-  Level scratch_buf(tgt.allocator_);
-  scratch_buf.reserve(2 * tgt.get_k());
+  // k items sampled from a source level followed by the 2k scratch items of the propagation
+  T* down_buf = tgt.get_merge_scratch();
 
   uint64_t src_pattern = src.bit_pattern_;
   for (uint8_t src_lvl = 0; src_pattern != 0; ++src_lvl, src_pattern >>= 1) {
     if ((src_pattern & 1) > 0) {
-      down_buf.clear();
-      scratch_buf.clear();
-
       // zip with stride, leaving input buffer intact
-      zip_buffer_with_stride(src.levels_[src_lvl], down_buf, downsample_factor);
+      zip_buffer_with_stride<FwdSk>(src.get_level(src_lvl), down_buf, tgt.k_, downsample_factor);
+      items_guard sampled(down_buf, tgt.k_);
 
       // propagate-carry
-      in_place_propagate_carry(src_lvl + lg_sample_factor,
-                               down_buf, scratch_buf,
-                               false, tgt);
+      in_place_propagate_carry<quantiles_sketch>(src_lvl + lg_sample_factor,
+                                                 down_buf, down_buf + tgt.k_,
+                                                 false, tgt);
       // update n_ at the end
     }
   }
@@ -1244,6 +1311,26 @@ class quantiles_sketch<T, C, A>::item_deleter {
   A allocator_;
 };
 
+template<typename T, typename C, typename A>
+class quantiles_sketch<T, C, A>::items_guard {
+  public:
+  // the first num items are built already
+  items_guard(T* items, uint32_t num): items_(items), num_(num) {}
+  items_guard(const items_guard&) = delete;
+  items_guard& operator=(const items_guard&) = delete;
+  ~items_guard() { destroy_items(items_, num_); }
+  template<typename... Args>
+  void emplace_back(Args&&... args) {
+    new (&items_[num_]) T(std::forward<Args>(args)...);
+    ++num_;
+  }
+  // the items are kept by the caller
+  void release() { num_ = 0; }
+  private:
+  T* items_;
+  uint32_t num_;
+};
+
 template<typename T, typename C, typename A>
 class quantiles_sketch<T, C, A>::items_deleter {
   public:
@@ -1266,33 +1353,42 @@ class quantiles_sketch<T, C, A>::items_deleter {
 };
 
 template<typename T, typename C, typename A>
-void quantiles_sketch<T, C, A>::setup_sorted_view() const {
-  if (sorted_view_ == nullptr) {
+auto quantiles_sketch<T, C, A>::setup_sorted_view() const -> const quantiles_sorted_view<T, C, A>& {
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.load(std::memory_order_acquire);
+  if (view == nullptr) {
+    // concurrent queries may each build a view, the first one to be published is kept
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    sorted_view_ = new (AllocSortedView(allocator_).allocate(1)) quantiles_sorted_view<T, C, A>(get_sorted_view());
+    AllocSortedView alloc(allocator_);
+    quantiles_sorted_view<T, C, A> built = get_sorted_view();
+    view = new (alloc.allocate(1)) quantiles_sorted_view<T, C, A>(std::move(built));
+    quantiles_sorted_view<T, C, A>* published = nullptr;
+    if (!sorted_view_.compare_exchange_strong(published, view, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      view->~quantiles_sorted_view();
+      alloc.deallocate(view, 1);
+      view = published;
+    }
   }
+  return *view;
 }
 
 template<typename T, typename C, typename A>
 void quantiles_sketch<T, C, A>::reset_sorted_view() {
-  if (sorted_view_ != nullptr) {
-    sorted_view_->~quantiles_sorted_view();
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.exchange(nullptr);
+  if (view != nullptr) {
+    view->~quantiles_sorted_view();
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    AllocSortedView(allocator_).deallocate(sorted_view_, 1);
-    sorted_view_ = nullptr;
+    AllocSortedView(allocator_).deallocate(view, 1);
   }
 }
 
 // quantiles_sketch::const_iterator implementation
 
 template<typename T, typename C, typename A>
-quantiles_sketch<T, C, A>::const_iterator::const_iterator(const Level& base_buffer,
-                                                             const std::vector<Level, AllocLevel>& levels,
+quantiles_sketch<T, C, A>::const_iterator::const_iterator(const T* items,
                                                              uint16_t k,
                                                              uint64_t n,
                                                              bool is_end):
-base_buffer_(base_buffer),
-levels_(levels),
+items_(items),
 level_(-1),
 index_(0),
 bb_count_(compute_base_buffer_items(k, n)),
@@ -1306,7 +1402,7 @@ k_(k)
     if (bit_pattern_ == 0) // only a valid check for exact mode in constructor
       index_ = static_cast<uint32_t>(n);
     else
-      level_ = static_cast<int>(levels_.size());
+      level_ = compute_levels_needed(k, n);
   } else { // find first non-empty item
     if (bb_count_ == 0 && bit_pattern_ > 0) {
       level_ = 0;
@@ -1324,7 +1420,7 @@ template<typename T, typename C, typename A>
 typename quantiles_sketch<T, C, A>::const_iterator& quantiles_sketch<T, C, A>::const_iterator::operator++() {
   ++index_;
 
-  if ((level_ == -1 && index_ == base_buffer_.size() && levels_.size() > 0) || (level_ >= 0 && index_ == k_)) { // go to the next non-empty level
+  if ((level_ == -1 && index_ == bb_count_ && bit_pattern_ > 0) || (level_ >= 0 && index_ == k_)) { // go to the next non-empty level
     index_ = 0;
     do {
       ++level_;
@@ -1355,7 +1451,7 @@ bool quantiles_sketch<T, C, A>::const_iterator::operator!=(const const_iterator&
 
 template<typename T, typename C, typename A>
 auto quantiles_sketch<T, C, A>::const_iterator::operator*() const -> const value_type {
-  return value_type(level_ == -1 ? base_buffer_[index_] : levels_[level_][index_], weight_);
+  return value_type(level_ == -1 ? items_[index_] : items_[2 * k_ + level_ * k_ + index_], weight_);
 }
 
 template<typename T, typename C, typename A>
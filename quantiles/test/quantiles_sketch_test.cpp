@@ -21,6 +21,8 @@
 #include <cmath>
 #include <sstream>
 #include <fstream>
+#include <stdexcept>
+#include <vector>
 
 #include <quantiles_sketch.hpp>
 #include <test_allocator.hpp>
@@ -267,6 +269,26 @@ TEST_CASE("quantiles sketch", "[quantiles_sketch]") {
     }
   }
 
+  SECTION("batch ranks") {
+    quantiles_float_sketch sketch(64, std::less<float>(), 0);
+    const int n = 10000;
+    for (int i = 0; i < n; i++) sketch.update(static_cast<float>(i % 5000)); // every item twice
+    std::vector<float> items;
+    for (int i = -1; i <= 5000; i += 3) {
+      items.push_back(static_cast<float>(i));
+      if (i % 2 == 0) items.push_back(static_cast<float>(i)); // repeated items in the batch
+    }
+    std::vector<float> shuffled(items.rbegin(), items.rend());
+    std::swap(shuffled[0], shuffled[shuffled.size() / 2]);
+    for (bool inclusive: {true, false}) {
+      for (const auto& batch: {items, shuffled}) {
+        const auto ranks = sketch.get_ranks(batch.data(), static_cast<uint32_t>(batch.size()), inclusive);
+        REQUIRE(ranks.size() == batch.size());
+        for (size_t i = 0; i < batch.size(); i++) REQUIRE(ranks[i] == sketch.get_rank(batch[i], inclusive));
+      }
+    }
+  }
+
   SECTION("inclusive true vs false") {
     quantiles_sketch<int> sketch(32);
     const int n = 100;
@@ -905,6 +927,94 @@ TEST_CASE("quantiles sketch", "[quantiles_sketch]") {
     }
   }
 
+  SECTION("base buffer and levels in one allocation") {
+    quantiles_float_sketch sketch(16, std::less<float>(), 0);
+    for (int i = 0; i < 1000; i++) sketch.update(static_cast<float>(i));
+    REQUIRE(sketch.is_estimation_mode());
+
+    // items, min and max
+    test_allocator_net_allocations = 0;
+    quantiles_float_sketch sketch2(sketch);
+    REQUIRE(test_allocator_net_allocations == 3);
+    auto bytes = sketch.serialize();
+    test_allocator_net_allocations = 0;
+    auto sketch3 = quantiles_float_sketch::deserialize(bytes.data(), bytes.size(), serde<float>(), std::less<float>(), 0);
+    REQUIRE(test_allocator_net_allocations == 3);
+
+    // both keep growing from there
+    for (int i = 1000; i < 10000; i++) {
+      sketch2.update(static_cast<float>(i));
+      sketch3.update(static_cast<float>(i));
+    }
+    REQUIRE(sketch3.get_n() == sketch2.get_n());
+    REQUIRE(sketch3.get_num_retained() == sketch2.get_num_retained());
+    REQUIRE(sketch3.get_rank(5000) == Approx(0.5).margin(0.05));
+    REQUIRE(sketch2.get_rank(5000) == Approx(0.5).margin(0.05));
+  }
+
+  SECTION("no allocations in steady state") {
+    // 2k = 256, enough to go through the radix sort
+    quantiles_float_sketch sketch(128, std::less<float>(), 0);
+    for (int i = 0; i < 16384; i++) sketch.update(static_cast<float>(i));
+    quantiles_float_sketch same_k(128, std::less<float>(), 0);
+    for (int i = 0; i < 2000; i++) same_k.update(static_cast<float>(i));
+    quantiles_float_sketch higher_k(256, std::less<float>(), 0);
+    for (int i = 0; i < 2000; i++) higher_k.update(static_cast<float>(i));
+    sketch.merge(same_k); // allocates the scratch space of merges
+
+    // the levels allocated so far are enough for up to 32768 items
+    test_allocator_allocations = 0;
+    for (int i = 0; i < 4000; i++) sketch.update(static_cast<float>(i));
+    sketch.merge(same_k);
+    sketch.merge(higher_k);
+    sketch.merge(same_k);
+    for (int i = 0; i < 2000; i++) sketch.update(static_cast<float>(i));
+    REQUIRE(sketch.get_n() == 30384);
+    REQUIRE(test_allocator_allocations == 0);
+  }
+
+  SECTION("bulk update") {
+    std::vector<float> values;
+    for (int i = 0; i < 10000; i++) values.push_back(static_cast<float>((i * 7919) % 10000));
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+    auto build = [&values](bool bulk) {
+      random_utils::override_seed(1);
+      quantiles_float_sketch sketch(64, std::less<float>(), 0);
+      for (size_t i = 0; i < values.size(); i += 1000) {
+        const size_t end = std::min(i + 1000, values.size());
+        if (bulk) {
+          if (!sketch.is_empty()) sketch.get_rank(0); // make sure the cached sorted view is dropped
+          sketch.update(values.data() + i, values.data() + end);
+        } else {
+          for (size_t j = i; j < end; j++) sketch.update(values[j]);
+        }
+      }
+      return sketch;
+    };
+    auto sketch1 = build(false);
+    auto sketch2 = build(true);
+    REQUIRE(sketch2.get_n() == 10000);
+    REQUIRE(sketch2.get_min_item() == 0);
+    REQUIRE(sketch2.get_max_item() == 9999);
+    REQUIRE(sketch2.serialize() == sketch1.serialize());
+    REQUIRE(sketch2.get_rank(5000) == sketch1.get_rank(5000));
+    sketch2.update(values.data(), values.data());
+    REQUIRE(sketch2.get_n() == 10000);
+    random_utils::reset_seed();
+  }
+
+  SECTION("bulk update in exact mode") {
+    const std::vector<std::string> values {"c", "a", "d", "b"};
+    quantiles_string_sketch sketch(128, std::less<std::string>(), 0);
+    sketch.update(values.begin(), values.begin() + 1);
+    REQUIRE(sketch.get_quantile(0.5) == "c");
+    sketch.update(values.begin() + 1, values.end());
+    REQUIRE(sketch.get_n() == 4);
+    REQUIRE(sketch.get_min_item() == "a");
+    REQUIRE(sketch.get_max_item() == "d");
+    REQUIRE(sketch.get_quantile(0.5) == "b");
+  }
+
   SECTION("Type converting copy constructor") {
     const uint16_t k = 8;
     const int n = 403;
@@ -974,10 +1084,127 @@ TEST_CASE("quantiles sketch", "[quantiles_sketch]") {
     REQUIRE(sketch.get_allocator() == std::allocator<int>());
   }
 
+  SECTION("freeze") {
+    quantiles_string_sketch sketch(128, std::less<std::string>(), 0);
+    REQUIRE(sketch.freeze().is_empty());
+    for (int i = 0; i < 1000; i++) sketch.update(std::to_string(i));
+    auto snapshot = sketch.freeze();
+    REQUIRE(snapshot.get_n() == 1000);
+    REQUIRE(snapshot.get_num_retained() == sketch.get_num_retained());
+    REQUIRE(snapshot.get_min_item() == "0");
+    REQUIRE(snapshot.get_max_item() == "999");
+    const std::string median = sketch.get_quantile(0.5);
+    REQUIRE(snapshot.get_quantile(0.5) == median);
+    REQUIRE(snapshot.get_rank("5") == sketch.get_rank("5"));
+    sketch = quantiles_string_sketch(128, std::less<std::string>(), 0);
+    REQUIRE(snapshot.get_quantile(0.5) == median);
+  }
+
+  SECTION("queries and serialization do not modify the sketch") {
+    quantiles_float_sketch sketch(128, std::less<float>(), 0);
+    for (int i = 300; i > 0; i--) sketch.update(static_cast<float>(i)); // unsorted base buffer
+    auto bytes = sketch.serialize();
+    REQUIRE(sketch.get_rank(100) == Approx(100 / 300.0).margin(0.01));
+    REQUIRE(sketch.serialize() == bytes);
+    auto sketch2 = quantiles_float_sketch::deserialize(bytes.data(), bytes.size(), serde<float>(), std::less<float>(), 0);
+    REQUIRE(sketch2.get_rank(100) == sketch.get_rank(100));
+    REQUIRE(sketch2.get_quantile(0.5) == sketch.get_quantile(0.5));
+  }
+
   // cleanup
   if (test_allocator_total_bytes != 0) {
     REQUIRE(test_allocator_total_bytes == 0);
   }
 }
 
+// counts the live instances, the constructors throw once the given number of constructions is reached
+struct throwing_item {
+  static int live;
+  static int constructions_left; // negative for no limit
+  int value;
+  throwing_item(int value): value(value) { construct(); }
+  throwing_item(const throwing_item& other): value(other.value) { construct(); }
+  throwing_item(throwing_item&& other): value(other.value) { construct(); }
+  throwing_item& operator=(const throwing_item& other) = default;
+  throwing_item& operator=(throwing_item&& other) = default;
+  ~throwing_item() { --live; }
+  bool operator<(const throwing_item& other) const { return value < other.value; }
+  static void construct() {
+    if (constructions_left == 0) throw std::runtime_error("throwing_item");
+    if (constructions_left > 0) --constructions_left;
+    ++live;
+  }
+};
+int throwing_item::live = 0;
+int throwing_item::constructions_left = -1;
+
+// runs the function with the constructions failing after 0, 1, 2... of them until it completes,
+// and checks that every run leaves as many live items as there were before
+template<typename F>
+static void check_no_leaks(F f) {
+  const int live = throwing_item::live;
+  for (int num = 0; ; ++num) {
+    throwing_item::constructions_left = num;
+    bool thrown = false;
+    try {
+      f();
+    } catch (std::runtime_error&) {
+      thrown = true;
+    }
+    throwing_item::constructions_left = -1;
+    REQUIRE(throwing_item::live == live);
+    if (!thrown) break;
+  }
+}
+
+TEST_CASE("quantiles sketch: items that throw", "[quantiles_sketch]") {
+  using sketch_type = quantiles_sketch<throwing_item>;
+  sketch_type sketch(16);
+  for (int i = 0; i < 300; i++) sketch.update(throwing_item(i));
+  sketch_type higher_k(32);
+  for (int i = 0; i < 300; i++) higher_k.update(throwing_item(i));
+
+  SECTION("update") {
+    check_no_leaks([]() {
+      sketch_type sk(16);
+      for (int i = 0; i < 300; i++) sk.update(throwing_item(i));
+    });
+  }
+
+  SECTION("bulk update") {
+    std::vector<throwing_item> items;
+    for (int i = 0; i < 300; i++) items.push_back(throwing_item(i));
+    check_no_leaks([&items]() {
+      sketch_type sk(16);
+      sk.update(items.begin(), items.end());
+    });
+  }
+
+  SECTION("copy") {
+    check_no_leaks([&sketch]() { sketch_type copy(sketch); });
+  }
+
+  SECTION("type conversion") {
+    quantiles_sketch<int> ints(16);
+    for (int i = 0; i < 300; i++) ints.update(i);
+    check_no_leaks([&ints]() { sketch_type converted(ints); });
+  }
+
+  SECTION("standard merge") {
+    check_no_leaks([&sketch]() {
+      sketch_type sk(16);
+      for (int i = 0; i < 100; i++) sk.update(throwing_item(i));
+      sk.merge(sketch);
+    });
+  }
+
+  SECTION("downsampling merge") {
+    check_no_leaks([&higher_k]() {
+      sketch_type sk(16);
+      for (int i = 0; i < 100; i++) sk.update(throwing_item(i));
+      sk.merge(higher_k);
+    });
+  }
+}
+
 } /* namespace datasketches */
@@ -27,6 +27,7 @@
 #include "count_zeros.hpp"
 #include "conditional_forward.hpp"
 #include "common_defs.hpp"
+#include "sort_utils.hpp"
 
 #include <iomanip>
 
@@ -188,7 +189,14 @@ uint8_t req_compactor<T, C, A>::get_lg_weight() const {
 
 template<typename T, typename C, typename A>
 uint64_t req_compactor<T, C, A>::compute_weight(const T& item, bool inclusive) const {
-  if (!sorted_) const_cast<req_compactor*>(this)->sort(); // allow sorting as a side effect
+  if (!sorted_) {
+    // counted without sorting, so that queries do not modify the compactor
+    const C& comparator = comparator_;
+    const auto count = inclusive ?
+        std::count_if(begin(), end(), [&item, &comparator](const T& x) { return !comparator(item, x); }) :
+        std::count_if(begin(), end(), [&item, &comparator](const T& x) { return comparator(x, item); });
+    return static_cast<uint64_t>(count) << lg_weight_;
+  }
   auto it = inclusive ?
       std::upper_bound(begin(), end(), item, comparator_) :
       std::lower_bound(begin(), end(), item, comparator_);
@@ -257,7 +265,7 @@ void req_compactor<T, C, A>::merge(FwdC&& other) {
   auto to = from + other.get_num_items();
   auto other_it = other.begin();
   for (auto it = from; it != to; ++it, ++other_it) new (it) T(conditional_forward<FwdC>(*other_it));
-  if (!other.sorted_) std::sort(from, to, comparator_);
+  if (!other.sorted_) sort_utils::sort(from, to, comparator_, allocator_);
   if (num_items_ > 0) std::inplace_merge(hra_ ? from : begin(), items_ + offset, hra_ ? end() : to, C());
   num_items_ += other.get_num_items();
 }
@@ -265,7 +273,7 @@ void req_compactor<T, C, A>::merge(FwdC&& other) {
 template<typename T, typename C, typename A>
 void req_compactor<T, C, A>::sort() {
   if (!sorted_) {
-    std::sort(begin(), end(), comparator_);
+    sort_utils::sort(begin(), end(), comparator_, allocator_);
     sorted_ = true;
   }
 }
@@ -279,7 +287,7 @@ std::pair<uint32_t, uint32_t> req_compactor<T, C, A>::compact(req_compactor& nex
   if (compaction_range.second - compaction_range.first < 2) throw std::logic_error("compaction range error");
 
   if ((state_ & 1) == 1) { coin_ = !coin_; } // for odd flip coin;
-  else { coin_ = random_bit(); } // random coin flip
+  else { coin_ = random_utils::random_bit(); } // random coin flip
 
   const auto num = (compaction_range.second - compaction_range.first) / 2;
   next.ensure_space(num);
@@ -495,7 +503,7 @@ comparator_(comparator),
 allocator_(allocator),
 lg_weight_(lg_weight),
 hra_(hra),
-coin_(random_bit()),
+coin_(random_utils::random_bit()),
 sorted_(sorted),
 section_size_raw_(section_size_raw),
 section_size_(nearest_even(section_size_raw)),
@@ -20,11 +20,13 @@
 #ifndef REQ_SKETCH_HPP_
 #define REQ_SKETCH_HPP_
 
+#include <atomic>
 #include <iterator>
 
 #include "req_common.hpp"
 #include "req_compactor.hpp"
 #include "quantiles_sorted_view.hpp"
+#include "quantiles_snapshot.hpp"
 
 namespace datasketches {
 
@@ -204,6 +206,22 @@ public:
    */
   vector_double get_CDF(const T* split_points, uint32_t size, bool inclusive = true) const;
 
+  /**
+   * This is a multiple-query version of get_rank().
+   *
+   * <p>If the items are sorted according to the comparator C, they are ranked in one pass
+   * over the sorted view. This is faster than calling get_rank() for each item.
+   *
+   * <p>If the sketch is empty this throws std::runtime_error.
+   *
+   * @param items array of items to be ranked
+   * @param size the number of items in the array
+   * @param inclusive if true the weight of each item is included into its rank
+   *
+   * @return array of approximate normalized ranks of the given items in the same order
+   */
+  vector_double get_ranks(const T* items, uint32_t size, bool inclusive = true) const;
+
   /**
    * Returns an approximate quantile of the given normalized rank.
    * The normalized rank must be in the range [0.0, 1.0] (both inclusive).
@@ -338,6 +356,15 @@ public:
 
   quantiles_sorted_view<T, Comparator, Allocator> get_sorted_view() const;
 
+  /**
+   * Returns an immutable snapshot of the sketch for queries.
+   * The snapshot has the sorted view built and its own copies of the items,
+   * so it is not affected by later updates and can be queried from many threads at once.
+   * Queries on the sketch itself are also safe to run concurrently as long as nothing modifies the sketch.
+   * @return snapshot for queries
+   */
+  quantiles_snapshot<T, Comparator, Allocator> freeze() const;
+
 private:
   Comparator comparator_;
   Allocator allocator_;
@@ -349,9 +376,9 @@ private:
   std::vector<Compactor, AllocCompactor> compactors_;
   T* min_item_;
   T* max_item_;
-  mutable quantiles_sorted_view<T, Comparator, Allocator>* sorted_view_;
+  mutable std::atomic<quantiles_sorted_view<T, Comparator, Allocator>*> sorted_view_; // built by the first query
 
-  void setup_sorted_view() const; // modifies mutable state
+  const quantiles_sorted_view<T, Comparator, Allocator>& setup_sorted_view() const; // safe for concurrent queries
   void reset_sorted_view();
 
   static const bool LAZY_COMPRESSION = false;
@@ -258,18 +258,22 @@ double req_sketch<T, C, A>::get_rank(const T& item, bool inclusive) const {
   return static_cast<double>(weight) / n_;
 }
 
+template<typename T, typename C, typename A>
+auto req_sketch<T, C, A>::get_ranks(const T* items, uint32_t size, bool inclusive) const -> vector_double {
+  if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
+  return setup_sorted_view().get_ranks(items, size, inclusive);
+}
+
 template<typename T, typename C, typename A>
 auto req_sketch<T, C, A>::get_PMF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_PMF(split_points, size, inclusive);
+  return setup_sorted_view().get_PMF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 auto req_sketch<T, C, A>::get_CDF(const T* split_points, uint32_t size, bool inclusive) const -> vector_double {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  setup_sorted_view();
-  return sorted_view_->get_CDF(split_points, size, inclusive);
+  return setup_sorted_view().get_CDF(split_points, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
@@ -278,45 +282,43 @@ auto req_sketch<T, C, A>::get_quantile(double rank, bool inclusive) const -> qua
   if ((rank < 0.0) || (rank > 1.0)) {
     throw std::invalid_argument("Normalized rank cannot be less than 0 or greater than 1");
   }
-  // possible side-effect of sorting level zero
-  setup_sorted_view();
-  return sorted_view_->get_quantile(rank, inclusive);
+  return setup_sorted_view().get_quantile(rank, inclusive);
 }
 
 template<typename T, typename C, typename A>
 std::vector<T, A> req_sketch<T, C, A>::get_quantiles(const double* ranks, uint32_t size, bool inclusive) const {
   if (is_empty()) throw std::runtime_error("operation is undefined for an empty sketch");
-  std::vector<T, A> quantiles(allocator_);
-  quantiles.reserve(size);
-
-  // possible side-effect of sorting level zero
-  setup_sorted_view();
-
   for (uint32_t i = 0; i < size; ++i) {
     const double rank = ranks[i];
     if ((rank < 0.0) || (rank > 1.0)) {
       throw std::invalid_argument("Normalized rank cannot be less than 0 or greater than 1");
     }
-    quantiles.push_back(sorted_view_->get_quantile(rank, inclusive));
   }
-  return quantiles;
+  return setup_sorted_view().get_quantiles(ranks, size, inclusive);
 }
 
 template<typename T, typename C, typename A>
 quantiles_sorted_view<T, C, A> req_sketch<T, C, A>::get_sorted_view() const {
-  if (!compactors_[0].is_sorted()) {
-    const_cast<Compactor&>(compactors_[0]).sort(); // allow this side effect
-  }
   quantiles_sorted_view<T, C, A> view(get_num_retained(), comparator_, allocator_);
 
   for (auto& compactor: compactors_) {
-    view.add(compactor.begin(), compactor.end(), 1 << compactor.get_lg_weight());
+    // the level zero compactor is left as is, so that queries do not modify the sketch
+    if (compactor.is_sorted()) {
+      view.add(compactor.begin(), compactor.end(), 1 << compactor.get_lg_weight());
+    } else {
+      view.add_unsorted(compactor.begin(), compactor.end(), 1 << compactor.get_lg_weight());
+    }
   }
 
   view.convert_to_cummulative();
   return view;
 }
 
+template<typename T, typename C, typename A>
+quantiles_snapshot<T, C, A> req_sketch<T, C, A>::freeze() const {
+  return quantiles_snapshot<T, C, A>(get_sorted_view(), n_, min_item_, max_item_, allocator_);
+}
+
 template<typename T, typename C, typename A>
 double req_sketch<T, C, A>::get_rank_lower_bound(double rank, uint8_t num_std_dev) const {
   return get_rank_lb(get_k(), get_num_levels(), rank, num_std_dev, get_n(), hra_);
@@ -792,20 +794,31 @@ auto req_sketch<T, C, A>::end() const -> const_iterator {
 }
 
 template<typename T, typename C, typename A>
-void req_sketch<T, C, A>::setup_sorted_view() const {
-  if (sorted_view_ == nullptr) {
+auto req_sketch<T, C, A>::setup_sorted_view() const -> const quantiles_sorted_view<T, C, A>& {
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.load(std::memory_order_acquire);
+  if (view == nullptr) {
+    // concurrent queries may each build a view, the first one to be published is kept
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    sorted_view_ = new (AllocSortedView(allocator_).allocate(1)) quantiles_sorted_view<T, C, A>(get_sorted_view());
+    AllocSortedView alloc(allocator_);
+    quantiles_sorted_view<T, C, A> built = get_sorted_view();
+    view = new (alloc.allocate(1)) quantiles_sorted_view<T, C, A>(std::move(built));
+    quantiles_sorted_view<T, C, A>* published = nullptr;
+    if (!sorted_view_.compare_exchange_strong(published, view, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      view->~quantiles_sorted_view();
+      alloc.deallocate(view, 1);
+      view = published;
+    }
   }
+  return *view;
 }
 
 template<typename T, typename C, typename A>
 void req_sketch<T, C, A>::reset_sorted_view() {
-  if (sorted_view_ != nullptr) {
-    sorted_view_->~quantiles_sorted_view();
+  quantiles_sorted_view<T, C, A>* view = sorted_view_.exchange(nullptr);
+  if (view != nullptr) {
+    view->~quantiles_sorted_view();
     using AllocSortedView = typename std::allocator_traits<A>::template rebind_alloc<quantiles_sorted_view<T, C, A>>;
-    AllocSortedView(allocator_).deallocate(sorted_view_, 1);
-    sorted_view_ = nullptr;
+    AllocSortedView(allocator_).deallocate(view, 1);
   }
 }
 
@@ -25,6 +25,7 @@
 #include <sstream>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 namespace datasketches {
 
@@ -53,6 +54,7 @@ TEST_CASE("req sketch: empty", "[req_sketch]") {
   const float split_points[1] {0};
   REQUIRE_THROWS_AS(sketch.get_CDF(split_points, 1), std::runtime_error);
   REQUIRE_THROWS_AS(sketch.get_PMF(split_points, 1), std::runtime_error);
+  REQUIRE_THROWS_AS(sketch.get_ranks(split_points, 1), std::runtime_error);
 }
 
 TEST_CASE("req sketch: single value, lra", "[req_sketch]") {
@@ -192,6 +194,14 @@ TEST_CASE("req sketch: estimation mode", "[req_sketch]") {
     ++count;
   }
   REQUIRE(count == sketch.get_num_retained());
+
+  // batch ranks come from the sorted view and must match ranks computed from compactors
+  std::vector<float> items;
+  for (size_t i = 0; i <= n; i += 997) items.push_back(static_cast<float>(i));
+  for (bool inclusive: {true, false}) {
+    const auto ranks = sketch.get_ranks(items.data(), static_cast<uint32_t>(items.size()), inclusive);
+    for (size_t i = 0; i < items.size(); ++i) REQUIRE(ranks[i] == sketch.get_rank(items[i], inclusive));
+  }
 }
 
 TEST_CASE("req sketch: stream serialize-deserialize empty", "[req_sketch]") {
@@ -564,6 +574,28 @@ TEST_CASE("get_rank equivalence") {
   }
 }
 
+TEST_CASE("req sketch: freeze", "[req_sketch]") {
+  req_sketch<float> sketch(12);
+  REQUIRE(sketch.freeze().is_empty());
+  const size_t n = 10000;
+  for (size_t i = 0; i < n; ++i) sketch.update(static_cast<float>(n - i));
+  auto snapshot = sketch.freeze();
+  REQUIRE(snapshot.get_n() == n);
+  REQUIRE(snapshot.get_min_item() == 1);
+  REQUIRE(snapshot.get_max_item() == n);
+  for (size_t i = 0; i <= n; i += 100) {
+    const float item = static_cast<float>(i);
+    REQUIRE(snapshot.get_rank(item) == sketch.get_rank(item));
+    REQUIRE(snapshot.get_rank(item, false) == sketch.get_rank(item, false));
+  }
+  for (size_t i = 0; i <= 100; ++i) {
+    REQUIRE(snapshot.get_quantile(i / 100.0) == sketch.get_quantile(i / 100.0));
+  }
+  const double rank = snapshot.get_rank(5000);
+  for (size_t i = 0; i < n; ++i) sketch.update(0);
+  REQUIRE(snapshot.get_rank(5000) == rank);
+}
+
 //TEST_CASE("for manual comparison with Java") {
 //  req_sketch<float> sketch(12, false);
 //  for (size_t i = 0; i < 100000; ++i) sketch.update(i);
@@ -1725,14 +1725,14 @@ uint32_t var_opt_sketch<T, A>::to_log_2(uint32_t v) {
 template<typename T, typename A>
 uint32_t var_opt_sketch<T, A>::next_int(uint32_t max_value) {
   std::uniform_int_distribution<uint32_t> dist(0, max_value - 1);
-  return dist(random_utils::rand);
+  return dist(random_utils::engine());
 }
 
 template<typename T, typename A>
 double var_opt_sketch<T, A>::next_double_exclude_zero() {
-  double r = random_utils::next_double(random_utils::rand);
+  double r = random_utils::next_double();
   while (r == 0.0) {
-    r = random_utils::next_double(random_utils::rand);
+    r = random_utils::next_double();
   }
   return r;
 }